@@ -0,0 +1,19 @@
+//! [0]
+QFile input("export.csv");
+QFile output("filtered.csv");
+if(!input.open(QIODevice::ReadOnly) || !output.open(QIODevice::WriteOnly))
+	return;
+
+Qx::DsvReader reader(&input);
+Qx::DsvWriter writer(&output);
+
+QStringList row;
+while(reader.readRow(row))
+{
+	if(row.at(2) == u"active"_s)
+		writer.writeRow(row);
+}
+
+if(reader.hasError())
+	qWarning() << reader.error().errorString() << "at offset" << reader.error().offset();
+//! [0]
@@ -5,7 +5,7 @@ Qx::Table<int> table({
 	{6, 7, 8}
 });
 
-Qx::DsvTable<int> sectionTable({
+Qx::Table<int> sectionTable({
 	{1, 2},
 	{4, 5},
 	{7, 8}
@@ -0,0 +1,193 @@
+#ifndef QX_HASHINDEX_H
+#define QX_HASHINDEX_H
+
+// Standard Library Includes
+#include <bit>
+#include <utility>
+
+// Qt Includes
+#include <QList>
+
+/*! @cond */
+namespace _QxPrivate
+{
+
+class HashIndex
+{
+    /* An open-addressed (linear probing) table that maps hashes to the indices of elements in some
+     * external, contiguous storage. Keys are never held here; instead, comparisons are delegated to
+     * the owner through a matcher that is handed a candidate index. Because slots move around during
+     * growth and backward-shift deletion, the owner is told about every relocation so that it can keep
+     * a back-reference from each element to its slot. That way, when elements shift within storage,
+     * their slot can be updated directly without needing to hash or probe again.
+     *
+     * The table is kept at most half full so that probe sequences stay short, and its size is always
+     * a power of two so that wrapping is just a mask.
+     */
+//-Class Variables-------------------------------------------------------------------------------------------------
+public:
+    static constexpr qsizetype npos = -1;
+
+private:
+    static constexpr qsizetype MIN_SLOTS = 8;
+
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    struct Slot
+    {
+        qsizetype index = npos;
+        size_t hash = 0;
+    };
+
+//-Instance Variables-------------------------------------------------------------------------------------------
+private:
+    QList<Slot> mSlots;
+    qsizetype mCount = 0;
+
+//-Class Functions----------------------------------------------------------------------------------------------
+private:
+    static qsizetype slotsFor(qsizetype count)
+    {
+        return count ? std::max(MIN_SLOTS, static_cast<qsizetype>(std::bit_ceil(static_cast<size_t>(count) * 2))) : 0;
+    }
+
+//-Instance Functions-------------------------------------------------------------------------------------------
+private:
+    size_t mask() const { return static_cast<size_t>(mSlots.size() - 1); }
+    qsizetype home(size_t hash) const
+    {
+        /* Scramble the hash before masking since many hash functions (e.g. qHash for integers) are
+         * just the identity, which would otherwise cluster badly for keys that only differ in their high bits
+         */
+        quint64 h = hash;
+        h ^= h >> 31;
+        h *= 0x9E3779B97F4A7C15ull;
+        h ^= h >> 29;
+        return static_cast<qsizetype>(static_cast<size_t>(h) & mask());
+    }
+
+    qsizetype next(qsizetype slot) const { return static_cast<qsizetype>((slot + 1) & mask()); }
+
+public:
+    qsizetype count() const { return mCount; }
+    qsizetype slotCount() const { return mSlots.size(); }
+    qsizetype index(qsizetype slot) const { return mSlots.at(slot).index; }
+    void setIndex(qsizetype slot, qsizetype index) { mSlots[slot].index = index; }
+
+    template<typename Matcher>
+    qsizetype find(size_t hash, Matcher matches) const
+    {
+        // Returns the slot holding the matching element, or npos
+        if(mSlots.isEmpty())
+            return npos;
+
+        const Slot* table = mSlots.constData();
+        for(qsizetype s = home(hash); ; s = next(s))
+        {
+            const Slot& slot = table[s];
+            if(slot.index == npos)
+                return npos;
+            if(slot.hash == hash && matches(slot.index))
+                return s;
+        }
+    }
+
+    template<typename Matcher>
+    std::pair<qsizetype, bool> probe(size_t hash, Matcher matches) const
+    {
+        /* Returns the slot holding the matching element and true, or the empty slot where
+         * such an element should be placed and false. The caller must have already reserved
+         * room for one more element, so that an empty slot is guaranteed to exist.
+         */
+        Q_ASSERT(mCount < mSlots.size());
+        const Slot* table = mSlots.constData();
+        for(qsizetype s = home(hash); ; s = next(s))
+        {
+            const Slot& slot = table[s];
+            if(slot.index == npos)
+                return {s, false};
+            if(slot.hash == hash && matches(slot.index))
+                return {s, true};
+        }
+    }
+
+    void occupy(qsizetype slot, size_t hash, qsizetype index)
+    {
+        Q_ASSERT(mSlots.at(slot).index == npos && index != npos);
+        mSlots[slot] = Slot{.index = index, .hash = hash};
+        ++mCount;
+    }
+
+    template<typename Relocated>
+    void vacate(qsizetype slot, Relocated relocated)
+    {
+        /* Backward-shift deletion, which avoids tombstones. Each following element in the cluster is
+         * moved into the hole if the hole lies between its home slot and where it currently sits,
+         * which keeps every element reachable from its home slot.
+         *
+         * relocated(index, newSlot) is invoked for each element that moves.
+         */
+        Q_ASSERT(mSlots.at(slot).index != npos);
+        Slot* table = mSlots.data();
+        qsizetype hole = slot;
+        for(qsizetype s = next(slot); table[s].index != npos; s = next(s))
+        {
+            size_t displacement = static_cast<size_t>(s - home(table[s].hash)) & mask();
+            size_t distToHole = static_cast<size_t>(s - hole) & mask();
+            if(displacement >= distToHole)
+            {
+                table[hole] = table[s];
+                relocated(table[hole].index, hole);
+                hole = s;
+            }
+        }
+
+        table[hole] = Slot();
+        --mCount;
+    }
+
+    template<typename Relocated>
+    void reserve(qsizetype count, Relocated relocated)
+    {
+        // relocated(index, newSlot) is invoked for every element if the table is rebuilt
+        if(slotsFor(count) > mSlots.size())
+            rehash(count, relocated);
+    }
+
+    template<typename Relocated>
+    void rehash(qsizetype count, Relocated relocated)
+    {
+        // Rebuilds the table with room for at least 'count' (and at least the current count) elements
+        qsizetype newSize = slotsFor(std::max(count, mCount));
+        if(newSize == mSlots.size())
+            return;
+
+        QList<Slot> old = std::exchange(mSlots, QList<Slot>(newSize));
+        Slot* table = mSlots.data();
+        for(const Slot& o : std::as_const(old))
+        {
+            if(o.index == npos)
+                continue;
+
+            qsizetype s = home(o.hash);
+            while(table[s].index != npos)
+                s = next(s);
+
+            table[s] = o;
+            relocated(o.index, s);
+        }
+    }
+
+    void clear() { mSlots.clear(); mCount = 0; }
+
+    void swap(HashIndex& other)
+    {
+        mSlots.swap(other.mSlots);
+        std::swap(mCount, other.mCount);
+    }
+};
+
+}
+/*! @endcond */
+
+#endif // QX_HASHINDEX_H
@@ -0,0 +1,222 @@
+#ifndef QX_CONCURRENTCUMULATION_H
+#define QX_CONCURRENTCUMULATION_H
+
+// Standard Library Includes
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+// Qt Includes
+#include <QHash>
+#include <QList>
+#include <QReadWriteLock>
+
+// Extra-component Includes
+#include "qx/utility/qx-concepts.h"
+
+namespace Qx
+{
+
+template <typename K, typename V>
+    requires arithmetic<V>
+class ConcurrentCumulation
+{
+//-Class Variables-------------------------------------------------------------------------------------------------
+private:
+    /* Assumed cache line size. std::hardware_destructive_interference_size isn't used since its value can vary
+     * between compiler flags, which makes it unsuitable for use in a header
+     */
+    static constexpr size_t CACHE_LINE = 64;
+
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    struct alignas(CACHE_LINE) Slot
+    {
+        std::atomic<V> value;
+        const V scalar;
+
+        Slot(V v, V s) : value(v), scalar(s) {}
+    };
+
+    struct alignas(CACHE_LINE) Shard
+    {
+        std::atomic<V> sum{0};
+    };
+
+public:
+    class Handle
+    {
+        friend class ConcurrentCumulation<K, V>;
+    //-Instance Variables-------------------------------------------------------------------------------------------
+    private:
+        Slot* mSlot;
+
+    //-Constructor--------------------------------------------------------------------------------------------------
+    private:
+        Handle(Slot* slot) : mSlot(slot) {}
+
+    public:
+        Handle() : mSlot(nullptr) {}
+
+    //-Instance Functions-------------------------------------------------------------------------------------------
+    public:
+        bool isValid() const { return mSlot; }
+
+    //-Operators----------------------------------------------------------------------------------------------------
+    public:
+        bool operator==(const Handle& other) const = default;
+    };
+
+//-Instance Variables----------------------------------------------------------------------------------------------
+private:
+    mutable QReadWriteLock mLock;
+    QHash<K, std::shared_ptr<Slot>> mSlots;
+    std::unique_ptr<Shard[]> mShards;
+    int mShardCount;
+
+//-Constructor----------------------------------------------------------------------------------------------
+public:
+    explicit ConcurrentCumulation(int shards = 1) :
+        mShards(std::make_unique<Shard[]>(std::max(shards, 1))),
+        mShardCount(std::max(shards, 1))
+    {}
+
+    ConcurrentCumulation(const ConcurrentCumulation&) = delete;
+    ConcurrentCumulation& operator=(const ConcurrentCumulation&) = delete;
+
+//-Class Functions----------------------------------------------------------------------------------------------
+private:
+    static int threadNumber()
+    {
+        // Gives each thread that touches a cumulation of this type a fixed, sequential number
+        static std::atomic<int> next = 0;
+        thread_local int number = next.fetch_add(1, std::memory_order_relaxed);
+        return number;
+    }
+
+//-Instance Functions----------------------------------------------------------------------------------------------
+private:
+    void accumulate(V delta)
+    {
+        Shard& shard = mShards[mShardCount == 1 ? 0 : threadNumber() % mShardCount];
+        shard.sum.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    template<typename N>
+        requires std::integral<N>
+    N sMean(V total, qsizetype count) const
+    {
+        return count ? std::round(static_cast<double>(total)/count) : 0;
+    }
+
+    template<typename N>
+        requires std::floating_point<N>
+    N sMean(V total, qsizetype count) const
+    {
+        return count ? total/count : 0;
+    }
+
+public:
+    Handle insert(K component, V value = 0, V scalar = 1)
+    {
+        QWriteLocker locker(&mLock);
+        if(auto itr = mSlots.constFind(component); itr != mSlots.cend())
+        {
+            Handle h(itr->get());
+            locker.unlock();
+            setValue(h, value);
+            return h;
+        }
+
+        auto slot = std::make_shared<Slot>(value, scalar);
+        Handle h(slot.get());
+        mSlots.insert(component, std::move(slot));
+        accumulate(value * scalar);
+        return h;
+    }
+
+    Handle handle(K component) const
+    {
+        QReadLocker locker(&mLock);
+        auto itr = mSlots.constFind(component);
+        return itr != mSlots.cend() ? Handle(itr->get()) : Handle();
+    }
+
+    void setValue(Handle component, V value)
+    {
+        Slot* s = component.mSlot;
+        V old = s->value.exchange(value, std::memory_order_relaxed);
+        if(old != value)
+            accumulate(value * s->scalar - old * s->scalar);
+    }
+
+    void increase(Handle component, V amount)
+    {
+        Slot* s = component.mSlot;
+        s->value.fetch_add(amount, std::memory_order_relaxed);
+        accumulate(amount * s->scalar);
+    }
+
+    void reduce(Handle component, V amount)
+    {
+        Slot* s = component.mSlot;
+        s->value.fetch_sub(amount, std::memory_order_relaxed);
+        accumulate(-(amount * s->scalar));
+    }
+
+    void increment(Handle component) { increase(component, 1); }
+    void decrement(Handle component) { reduce(component, 1); }
+
+    void remove(K component)
+    {
+        QWriteLocker locker(&mLock);
+        if(auto slot = mSlots.take(component))
+        {
+            const Slot* s = slot.get();
+            accumulate(-(s->value.load(std::memory_order_relaxed) * s->scalar));
+        }
+    }
+
+    void clear()
+    {
+        QWriteLocker locker(&mLock);
+        mSlots.clear();
+        for(int i = 0; i < mShardCount; i++)
+            mShards[i].sum.store(0, std::memory_order_relaxed);
+    }
+
+    bool contains(K component) const { QReadLocker locker(&mLock); return mSlots.contains(component); }
+    V value(Handle component) const { return component.mSlot->value.load(std::memory_order_relaxed); }
+    V scalar(Handle component) const { return component.mSlot->scalar; }
+
+    V value(K component) const
+    {
+        Handle h = handle(component);
+        return h.isValid() ? value(h) : V();
+    }
+
+    V total() const
+    {
+        V total = 0;
+        for(int i = 0; i < mShardCount; i++)
+            total += mShards[i].sum.load(std::memory_order_relaxed);
+
+        return total;
+    }
+
+    QList<K> components() const { QReadLocker locker(&mLock); return mSlots.keys(); }
+    qsizetype count() const { QReadLocker locker(&mLock); return mSlots.count(); }
+    bool isEmpty() const { QReadLocker locker(&mLock); return mSlots.isEmpty(); }
+    int shardCount() const { return mShardCount; }
+
+    V mean() const
+    {
+        QReadLocker locker(&mLock);
+        return sMean<V>(total(), mSlots.count());
+    }
+};
+
+}
+
+#endif // QX_CONCURRENTCUMULATION_H
@@ -1,8 +1,17 @@
 #ifndef QX_CUMULATION_H
 #define QX_CUMULATION_H
 
+// Standard Library Includes
+#include <cmath>
+#include <span>
+#include <utility>
+
 // Qt Includes
 #include <QHash>
+#include <QList>
+
+// Intra-component Includes
+#include "qx/core/__private/qx-hashindex.h"
 
 // Extra-component Includes
 #include "qx/utility/qx-concepts.h"
@@ -19,174 +28,314 @@ template <typename K, typename V>
     requires arithmetic<V>
 class Cumulation
 {
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    struct Entry
+    {
+        K key;
+        V value;
+        V scalar;
+        qsizetype slot; // npos if the entry is free
+        quint32 generation; // Distinguishes the entry's current component from those that previously used it
+    };
+
+public:
+    class Handle
+    {
+        friend class Cumulation<K, V>;
+    //-Instance Variables-------------------------------------------------------------------------------------------
+    private:
+        qsizetype mIndex;
+        quint32 mGeneration;
+
+    //-Constructor--------------------------------------------------------------------------------------------------
+    private:
+        Handle(qsizetype index, quint32 generation) : mIndex(index), mGeneration(generation) {}
+
+    public:
+        Handle() : mIndex(-1), mGeneration(0) {}
+
+    //-Instance Functions-------------------------------------------------------------------------------------------
+    public:
+        bool isValid() const { return mIndex != -1; }
+
+    //-Operators----------------------------------------------------------------------------------------------------
+    public:
+        bool operator==(const Handle& other) const = default;
+    };
+
+//-Aliases----------------------------------------------------------------------------------------------------------
+private:
+    using Index = _QxPrivate::HashIndex;
+
 //-Instance Variables----------------------------------------------------------------------------------------------
 private:
-    QHash<K, V> mComponents;
-    QHash<K, V> mScalars;
+    QList<Entry> mEntries;
+    QList<qsizetype> mFree;
+    Index mIndex;
     V mTotal;
+    quint32 mGeneration;
 
 //-Constructor----------------------------------------------------------------------------------------------
 public:
     Cumulation() :
-        mTotal(0)
+        mTotal(0),
+        mGeneration(0)
     {}
 
 //-Instance Functions----------------------------------------------------------------------------------------------
 private:
+    static size_t hash(const K& key) { return qHash(key); }
+
+    auto slotRelocator() { return [this](qsizetype idx, qsizetype slot){ mEntries[idx].slot = slot; }; }
+    auto keyMatcher(const K& key) const { return [this, &key](qsizetype idx){ return mEntries.at(idx).key == key; }; }
+
     template<typename N>
         requires std::integral<N>
     N sMean() const
     {
-        return !mComponents.isEmpty() ? std::round(static_cast<double>(mTotal)/mComponents.count()) : 0;
+        return !isEmpty() ? std::round(static_cast<double>(mTotal)/count()) : 0;
     }
 
     template<typename N>
         requires std::floating_point<N>
     N sMean() const
     {
-        return !mComponents.isEmpty() ? mTotal/mComponents.count() : 0;
+        return !isEmpty() ? mTotal/count() : 0;
     }
 
-    void basicInsert(K component, V value, V scalar)
+    qsizetype lookup(const K& key) const
     {
-        mTotal += value * scalar;
-        mComponents[component] = value;
-        mScalars[component] = scalar;
+        qsizetype slot = mIndex.find(hash(key), keyMatcher(key));
+        return slot != Index::npos ? mIndex.index(slot) : Index::npos;
     }
 
-public:
-    void insert(K component, V value, V scalar = 1)
+    qsizetype lookupOrAdd(const K& key)
     {
-        // If replacing an existing value, remove its portion from the running total if its not the same
-        if(mComponents.contains(component))
+        // New components start with a value of 0 and a scalar of 1, which leaves the total unchanged
+        mIndex.reserve(mIndex.count() + 1, slotRelocator());
+        size_t h = hash(key);
+        auto [slot, exists] = mIndex.probe(h, keyMatcher(key));
+        if(exists)
+            return mIndex.index(slot);
+
+        // Every new component gets a fresh generation, so that handles to an entry's previous ones are stale
+        qsizetype idx;
+        if(!mFree.isEmpty())
+        {
+            idx = mFree.takeLast();
+            mEntries[idx] = Entry{key, 0, 1, slot, ++mGeneration};
+        }
+        else
         {
-            const V& curVal = mComponents[component];
-            const V& curScal = mScalars[component];
-
-            // Remove old component portion from running total if different
-            if(curVal != value || curScal != scalar)
-                mTotal -= curVal * curScal;
-            else
-                return;
+            idx = mEntries.size();
+            mEntries.append(Entry{key, 0, 1, slot, ++mGeneration});
         }
 
-        // Insert/replace
-        basicInsert(component, value, scalar);
+        mIndex.occupy(slot, h, idx);
+        return idx;
     }
 
-    void setValue(K component, V value)
+    Handle handleAt(qsizetype idx) const
     {
-        if(mComponents.contains(component))
-        {
-            V& curVal = mComponents[component];
-            if(value != curVal)
-            {
-                const V& scalar = mScalars[component];
-                mTotal += (value * scalar) - (curVal * scalar);
-                curVal = value;
-            }
-        }
-        else
-            basicInsert(component, value, 1);
+        return idx != Index::npos ? Handle(idx, mEntries.at(idx).generation) : Handle();
     }
 
-    void setScalar(K component, V scalar)
+    Entry& entry(Handle handle)
     {
-        if(mComponents.contains(component))
-        {
-            V& curScalar = mScalars[component];
-            if(scalar != curScalar)
-            {
-                const V& value = mComponents[component];
-                mTotal += (value * scalar) - (value * curScalar);
-                curScalar = scalar;
-            }
-        }
-        else
-            basicInsert(component, 0, scalar);
+        Q_ASSERT_X(contains(handle), Q_FUNC_INFO, "handle is null or stale");
+        return mEntries[handle.mIndex];
     }
 
-    void increase(K component, V amount)
+    const Entry& entry(Handle handle) const
+    {
+        Q_ASSERT_X(contains(handle), Q_FUNC_INFO, "handle is null or stale");
+        return mEntries.at(handle.mIndex);
+    }
+
+public:
+    Handle handle(K component) const { return handleAt(lookup(component)); }
+
+    Handle insert(K component, V value, V scalar = 1)
     {
-        if(mComponents.contains(component))
+        Handle h = handleAt(lookupOrAdd(component));
+        Entry& e = entry(h);
+
+        // Replace the component's portion of the running total if it changed
+        if(e.value != value || e.scalar != scalar)
         {
-            mTotal += amount * mScalars[component];
-            mComponents[component] += amount;
+            mTotal -= e.value * e.scalar;
+            mTotal += value * scalar;
+            e.value = value;
+            e.scalar = scalar;
         }
-        else
-            basicInsert(component, amount, 1);
+
+        return h;
     }
 
-    void reduce(K component, V amount)
+    void setValue(Handle component, V value)
     {
-        if(mComponents.contains(component))
+        Entry& e = entry(component);
+        if(value != e.value)
         {
-            mTotal -= amount * mScalars[component];
-            mComponents[component] -= amount;
+            mTotal += (value * e.scalar) - (e.value * e.scalar);
+            e.value = value;
         }
-        else
-            basicInsert(component, -amount, 1);
     }
 
-    V increment(K component)
+    void setValue(K component, V value) { setValue(handleAt(lookupOrAdd(component)), value); }
+
+    void setScalar(Handle component, V scalar)
     {
-        if(mComponents.contains(component))
+        Entry& e = entry(component);
+        if(scalar != e.scalar)
         {
-            mTotal += mScalars[component];
-            mComponents[component]++;
+            mTotal += (e.value * scalar) - (e.value * e.scalar);
+            e.scalar = scalar;
         }
-        else
-            basicInsert(component, 1, 1);
+    }
+
+    void setScalar(K component, V scalar) { setScalar(handleAt(lookupOrAdd(component)), scalar); }
+
+    void increase(Handle component, V amount)
+    {
+        Entry& e = entry(component);
+        mTotal += amount * e.scalar;
+        e.value += amount;
+    }
+
+    void increase(K component, V amount) { increase(handleAt(lookupOrAdd(component)), amount); }
+
+    void reduce(Handle component, V amount)
+    {
+        Entry& e = entry(component);
+        mTotal -= amount * e.scalar;
+        e.value -= amount;
+    }
+
+    void reduce(K component, V amount) { reduce(handleAt(lookupOrAdd(component)), amount); }
+
+    V increment(Handle component)
+    {
+        Entry& e = entry(component);
+        mTotal += e.scalar;
+        e.value++;
 
         return mTotal;
     }
 
-    V decrement(K component)
+    V increment(K component) { return increment(handleAt(lookupOrAdd(component))); }
+
+    V decrement(Handle component)
     {
-        if(mComponents.contains(component))
-        {
-            mTotal -= mScalars[component];
-            mComponents[component]--;
-        }
-        else
-            basicInsert(component, -1, 1);
+        Entry& e = entry(component);
+        mTotal -= e.scalar;
+        e.value--;
 
         return mTotal;
     }
 
-    void remove(K component)
+    V decrement(K component) { return decrement(handleAt(lookupOrAdd(component))); }
+
+    void applyDeltas(std::span<const std::pair<K, V>> deltas)
     {
-        if(mComponents.contains(component))
+        // Make room for every delta being a new component up front so that the index is rebuilt at most once
+        mIndex.reserve(mIndex.count() + deltas.size(), slotRelocator());
+
+        V change = 0;
+        for(const auto& [component, amount] : deltas)
         {
-            mTotal -= (mComponents[component] * mScalars[component]);
-            mComponents.remove(component);
-            mScalars.remove(component);
+            Entry& e = mEntries[lookupOrAdd(component)];
+            change += amount * e.scalar;
+            e.value += amount;
         }
+
+        mTotal += change;
+    }
+
+    void remove(Handle component)
+    {
+        Entry& e = entry(component);
+        mTotal -= e.value * e.scalar;
+        mIndex.vacate(e.slot, slotRelocator());
+        e.slot = Index::npos;
+        mFree.append(component.mIndex);
+    }
+
+    void remove(K component)
+    {
+        qsizetype idx = lookup(component);
+        if(idx != Index::npos)
+            remove(handleAt(idx));
     }
 
     void clear()
     {
-        mComponents.clear();
-        mScalars.clear();
+        mEntries.clear();
+        mFree.clear();
+        mIndex.clear();
         mTotal = 0;
     }
 
-    bool contains(K component) const { return mComponents.contains(component); }
-    V value(K component) const { return mComponents.value(component); }
+    bool contains(K component) const { return lookup(component) != Index::npos; }
+
+    bool contains(Handle component) const
+    {
+        if(component.mIndex < 0 || component.mIndex >= mEntries.size())
+            return false;
+
+        const Entry& e = mEntries.at(component.mIndex);
+        return e.slot != Index::npos && e.generation == component.mGeneration;
+    }
+    V value(Handle component) const { return entry(component).value; }
+
+    V value(K component) const
+    {
+        qsizetype idx = lookup(component);
+        return idx != Index::npos ? mEntries.at(idx).value : V();
+    }
+
     V total() const { return mTotal; }
-    QList<K> components() const { return mComponents.keys(); }
 
-    qsizetype count() const { return mComponents.count(); }
-    bool isEmpty() const { return mComponents.isEmpty(); }
+    QList<K> components() const
+    {
+        QList<K> keys;
+        keys.reserve(count());
+        for(const Entry& e : mEntries)
+            if(e.slot != Index::npos)
+                keys.append(e.key);
+
+        return keys;
+    }
+
+    qsizetype count() const { return mIndex.count(); }
+    bool isEmpty() const { return mIndex.count() == 0; }
     V mean() const { return sMean<V>(); }
 
     bool operator==(const Cumulation& other) const
     {
-        return mComponents == other.mComponents && mScalars == other.mScalars && mTotal == other.mTotal;
+        if(count() != other.count() || mTotal != other.mTotal)
+            return false;
+
+        for(const Entry& e : mEntries)
+        {
+            if(e.slot == Index::npos)
+                continue;
+
+            qsizetype otherIdx = other.lookup(e.key);
+            if(otherIdx == Index::npos)
+                return false;
+
+            const Entry& oe = other.mEntries.at(otherIdx);
+            if(oe.value != e.value || oe.scalar != e.scalar)
+                return false;
+        }
+
+        return true;
     }
 
     bool operator!=(const Cumulation& other) const  { return !(*this == other); }
-};	
+};
 
 }
 
@@ -4,9 +4,19 @@
 // Shared Lib Support
 #include "qx/core/qx_core_export.h"
 
+// Standard Library Includes
+#include <memory>
+#include <span>
+
 // Qt Includes
 #include <QVariant>
 #include <QSize>
+#include <QStringList>
+#include <QStringEncoder>
+#include <QIODevice>
+#include <QUtf8StringView>
+
+class QThreadPool;
 
 // Intra-component Includes
 #include "qx/core/qx-table.h"
@@ -16,6 +26,8 @@ using namespace Qt::Literals::StringLiterals;
 namespace Qx
 {
 
+class DsvTokenizer;
+
 class QX_CORE_EXPORT DsvParseError
 {
 //-Class Enum-----------------------------------------------------------------------------------------------------------
@@ -25,7 +37,8 @@ public:
         IllegalEscape,
         UnterminatedField,
         UnevenColumns,
-        InternalError
+        InternalError,
+        TypeMismatch
     };
 
 //-Class Variables------------------------------------------------------------------------------------------------------
@@ -35,7 +48,8 @@ private:
         {IllegalEscape, u"Illegal use of an escape character."_s},
         {UnterminatedField, u"An escaped field was not properly terminated."_s},
         {UnevenColumns, u"A row contained a different number of fields than the header row."_s},
-        {InternalError, u"An internal parser error occurred."_s}
+        {InternalError, u"An internal parser error occurred."_s},
+        {TypeMismatch, u"A field could not be converted to the type of its column."_s}
     };
 
 //-Instance Variables------------------------------------------------------------------------------------------------------------
@@ -67,12 +81,163 @@ public:
 //-Class Functions----------------------------------------------------------------------------------------------
 public:
     static DsvTable fromDsv(const QByteArray& dsv, QChar delim = ',', QChar esc = '"', DsvParseError* error = nullptr);
+    static DsvTable fromDsvConcurrent(const QByteArray& dsv, QChar delim = ',', QChar esc = '"', DsvParseError* error = nullptr,
+                                      QThreadPool* pool = nullptr);
 
 //-Instance Functions----------------------------------------------------------------------------------------------
 public:
     QByteArray toDsv(QChar delim = ',', QChar esc = '"');
 };
 
+class QX_CORE_EXPORT TypedDsvTable
+{
+//-Class Enums-----------------------------------------------------------------------------------------------------------
+public:
+    enum ColumnType
+    {
+        Auto,
+        String,
+        Integer,
+        Real,
+        Boolean
+    };
+
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    struct Column
+    {
+        ColumnType type = String;
+        QList<qint64> integers;
+        QList<double> reals;
+        QList<bool> booleans;
+        QByteArray text;
+        QList<qsizetype> textOffsets;
+    };
+
+    class Builder;
+
+//-Instance Variables------------------------------------------------------------------------------------------------------------
+private:
+    QStringList mHeaders;
+    QList<Column> mColumns;
+    qsizetype mRows;
+
+//-Constructor----------------------------------------------------------------------------------------------
+public:
+    TypedDsvTable();
+
+//-Class Functions----------------------------------------------------------------------------------------------
+public:
+    static TypedDsvTable fromDsv(const QByteArray& dsv, QChar delim = ',', QChar esc = '"', DsvParseError* error = nullptr);
+    static TypedDsvTable fromDsv(const QByteArray& dsv, const QList<ColumnType>& schema, bool hasHeader,
+                                 QChar delim = ',', QChar esc = '"', DsvParseError* error = nullptr);
+
+//-Instance Functions----------------------------------------------------------------------------------------------
+public:
+    qsizetype columnCount() const;
+    ColumnType columnType(qsizetype c) const;
+    QStringList headers() const;
+    bool isEmpty() const;
+    qsizetype rowCount() const;
+    QSize size() const;
+
+    std::span<const qint64> integerColumn(qsizetype c) const;
+    std::span<const double> realColumn(qsizetype c) const;
+    std::span<const bool> booleanColumn(qsizetype c) const;
+
+    qint64 integerAt(qsizetype r, qsizetype c) const;
+    double realAt(qsizetype r, qsizetype c) const;
+    bool booleanAt(qsizetype r, qsizetype c) const;
+    QUtf8StringView stringAt(qsizetype r, qsizetype c) const;
+    QVariant value(qsizetype r, qsizetype c) const;
+
+    DsvTable toDsvTable() const;
+};
+
+class QX_CORE_EXPORT DsvReader
+{
+//-Class Variables------------------------------------------------------------------------------------------------------
+private:
+    static constexpr qsizetype CHUNK_SIZE = 64 * 1024;
+
+//-Instance Variables------------------------------------------------------------------------------------------------------------
+private:
+    QIODevice* mDevice;
+    QChar mDelim;
+    QChar mEsc;
+    std::unique_ptr<DsvTokenizer> mTokenizer;
+    QByteArray mChunk;
+    QStringList mFields;
+    QList<qsizetype> mRowEnds;
+    qsizetype mNextRow;
+    qsizetype mNextField;
+    bool mFinished;
+    DsvParseError mError;
+    int mReadTimeout;
+
+//-Constructor-------------------------------------------------------------------------------------------------
+public:
+    explicit DsvReader(QIODevice* device, QChar delim = ',', QChar esc = '"');
+
+//-Destructor-------------------------------------------------------------------------------------------------
+public:
+    ~DsvReader();
+
+//-Instance Functions---------------------------------------------------------------------------------------------------------
+private:
+    bool fill();
+
+public:
+    QIODevice* device() const;
+    qsizetype columnCount() const;
+    DsvParseError error() const;
+    bool hasError() const;
+    bool atEnd() const;
+    int readTimeout() const;
+    void setReadTimeout(int msecs);
+
+    bool readRow(QStringList& row);
+};
+
+class QX_CORE_EXPORT DsvWriter
+{
+//-Class Variables------------------------------------------------------------------------------------------------------
+private:
+    static constexpr qsizetype FLUSH_THRESHOLD = 64 * 1024;
+
+//-Instance Variables------------------------------------------------------------------------------------------------------------
+private:
+    QIODevice* mDevice;
+    QChar mDelim;
+    QChar mEsc;
+    QStringEncoder mEncoder;
+    QByteArray mBuffer;
+    qsizetype mColumnCount;
+
+//-Constructor-------------------------------------------------------------------------------------------------
+public:
+    explicit DsvWriter(QIODevice* device, QChar delim = ',', QChar esc = '"');
+
+//-Destructor-------------------------------------------------------------------------------------------------
+public:
+    ~DsvWriter();
+
+//-Instance Functions---------------------------------------------------------------------------------------------------------
+private:
+    bool beginRow(qsizetype size);
+    void writeField(QStringView field, bool first);
+    bool endRow();
+
+public:
+    QIODevice* device() const;
+    qsizetype columnCount() const;
+
+    bool writeRow(const QStringList& row);
+    bool writeRow(const QList<QVariant>& row);
+    bool writeRow(DsvTable::const_view row);
+    bool flush();
+};
+
 }
 
 #endif // QX_DSVTABLE_H
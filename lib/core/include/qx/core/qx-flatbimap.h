@@ -0,0 +1,463 @@
+#ifndef QX_FLATBIMAP_H
+#define QX_FLATBIMAP_H
+
+#include <stdexcept>
+
+// Qt Includes
+#include <QHash>
+#include <QList>
+
+// Intra-component Includes
+#include "qx/core/qx-bimap.h"
+#include "qx/core/__private/qx-hashindex.h"
+
+// Extra-component Includes
+#include <qx/utility/qx-concepts.h>
+
+namespace Qx
+{
+
+template<typename Left, typename Right>
+class FlatBimap;
+
+template<typename Left, typename Right, typename Predicate>
+concept flatbimap_iterator_predicate = defines_call_for_s<Predicate, bool, typename FlatBimap<Left, Right>::const_iterator>;
+
+template<typename Left, typename Right, typename Predicate>
+concept flatbimap_pair_predicate = defines_call_for_s<Predicate, bool, std::pair<const Left&, const Right&>>;
+
+template<typename Left, typename Right, typename Predicate>
+concept flatbimap_predicate = flatbimap_iterator_predicate<Left, Right, Predicate> || flatbimap_pair_predicate<Left, Right, Predicate>;
+
+template<typename Left, typename Right>
+class FlatBimap
+{
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    struct Relation
+    {
+        Left left;
+        Right right;
+        qsizetype leftSlot;
+        qsizetype rightSlot;
+    };
+
+//-Aliases----------------------------------------------------------------------------------------------------------
+private:
+    using Storage = QList<Relation>;
+    using StorageItr = typename Storage::const_iterator;
+    using Index = _QxPrivate::HashIndex;
+
+//-Inner Classes (cont.)--------------------------------------------------------------------------------------------
+public:
+    class const_iterator
+    {
+        friend class FlatBimap<Left, Right>;
+    //-Instance Variables-------------------------------------------------------------------------------------------
+    private:
+        StorageItr mSItr;
+
+    //-Constructor--------------------------------------------------------------------------------------------------
+    private:
+        const_iterator(const StorageItr& sItr) : mSItr(sItr) {}
+
+    public:
+        const_iterator() {}
+
+    //-Instance Functions-------------------------------------------------------------------------------------------
+    public:
+        const Left& left() const { return mSItr->left; }
+        const Right& right() const { return mSItr->right; }
+
+    //-Operators---------------------------------------------------------------------------------------------
+    public:
+        bool operator==(const const_iterator& other) const = default;
+        std::pair<const Left&, const Right&> operator*() const { return std::pair<const Left&, const Right&>(left(), right()); }
+        const_iterator& operator++() { mSItr++; return *this; }
+
+        const_iterator operator++(int)
+        {
+            auto cur = *this;
+            mSItr++;
+            return cur;
+        }
+    };
+
+//-Aliases (cont.)----------------------------------------------------------------------------------------------
+public:
+    using iterator = const_iterator;
+    using left_type = Left;
+    using right_type = Right;
+    using ConstIterator = const_iterator;
+    using difference_type = typename Storage::difference_type;
+    using size_type = typename Storage::size_type;
+
+//-Instance Variables-------------------------------------------------------------------------------------------
+private:
+    Storage mRelations;
+    Index mLeftIndex;
+    Index mRightIndex;
+
+//-Constructor--------------------------------------------------------------------------------------------------
+public:
+    FlatBimap() {}
+
+    FlatBimap(std::initializer_list<std::pair<Left, Right>> list)
+    {
+        reserve(list.size());
+        for(auto it = list.begin(); it != list.end(); ++it)
+            insert(it->first, it->second);
+    }
+
+//-Instance Functions-------------------------------------------------------------------------------------------
+private:
+    auto leftRelocator() { return [this](qsizetype idx, qsizetype slot){ mRelations[idx].leftSlot = slot; }; }
+    auto rightRelocator() { return [this](qsizetype idx, qsizetype slot){ mRelations[idx].rightSlot = slot; }; }
+    auto leftMatcher(const Left& l) const { return [this, &l](qsizetype idx){ return mRelations.at(idx).left == l; }; }
+    auto rightMatcher(const Right& r) const { return [this, &r](qsizetype idx){ return mRelations.at(idx).right == r; }; }
+
+    qsizetype leftIndex(const Left& l) const
+    {
+        qsizetype slot = mLeftIndex.find(qHash(l), leftMatcher(l));
+        return slot != Index::npos ? mLeftIndex.index(slot) : Index::npos;
+    }
+
+    qsizetype rightIndex(const Right& r) const
+    {
+        qsizetype slot = mRightIndex.find(qHash(r), rightMatcher(r));
+        return slot != Index::npos ? mRightIndex.index(slot) : Index::npos;
+    }
+
+    const_iterator iteratorAt(qsizetype idx) const { return const_iterator(idx != Index::npos ? mRelations.cbegin() + idx : mRelations.cend()); }
+
+    void eraseIndex(qsizetype idx)
+    {
+        /* Both slots are known via the relation itself, so no lookups are needed. The last relation
+         * is then moved into the gap to keep storage dense, which only requires re-pointing its slots.
+         */
+        const Relation& rel = mRelations.at(idx);
+        mLeftIndex.vacate(rel.leftSlot, leftRelocator());
+        mRightIndex.vacate(rel.rightSlot, rightRelocator());
+
+        qsizetype lastIdx = mRelations.size() - 1;
+        if(idx != lastIdx)
+        {
+            mRelations[idx] = std::move(mRelations[lastIdx]);
+            const Relation& moved = mRelations.at(idx);
+            mLeftIndex.setIndex(moved.leftSlot, idx);
+            mRightIndex.setIndex(moved.rightSlot, idx);
+        }
+
+        mRelations.removeLast();
+    }
+
+public:
+    iterator begin() { return constBegin(); }
+    const_iterator begin() const { return constBegin(); }
+    const_iterator cbegin() const { return constBegin(); }
+    const_iterator constBegin() const { return const_iterator(mRelations.cbegin()); }
+    iterator end() { return constEnd(); }
+    const_iterator end() const { return constEnd(); }
+    const_iterator cend() const { return constEnd(); }
+    const_iterator constEnd() const { return const_iterator(mRelations.cend()); }
+    const_iterator constFind(const Left& l) const requires asymmetric_bimap<Left, Right> { return constFindLeft(l); }
+    const_iterator constFind(const Right& r) const requires asymmetric_bimap<Left, Right> { return constFindRight(r); }
+    const_iterator constFindLeft(const Left& l) const { return iteratorAt(leftIndex(l)); }
+    const_iterator constFindRight(const Right& r) const { return iteratorAt(rightIndex(r)); }
+
+    iterator find(const Left& l) requires asymmetric_bimap<Left, Right> { return findLeft(l); }
+    const_iterator find(const Left& l) const requires asymmetric_bimap<Left, Right> { return findLeft(l); }
+    iterator find(const Right& r) requires asymmetric_bimap<Left, Right> { return findRight(r); }
+    const_iterator find(const Right& r) const requires asymmetric_bimap<Left, Right> { return findRight(r); }
+    iterator findLeft(const Left& l) { return constFindLeft(l); }
+    const_iterator findLeft(const Left& l) const { return constFindLeft(l); }
+    iterator findRight(const Right& r) { return constFindRight(r); }
+    const_iterator findRight(const Right& r) const { return constFindRight(r); }
+
+    const_iterator erase(const_iterator pos)
+    {
+        Q_ASSERT(pos != constEnd());
+        qsizetype idx = pos.mSItr - mRelations.cbegin();
+        eraseIndex(idx);
+        return iteratorAt(idx < mRelations.size() ? idx : Index::npos);
+    }
+
+    void insert(const FlatBimap& other)
+    {
+        if(this == &other)
+            return;
+
+        reserve(size() + other.size());
+        for(const Relation& rel : other.mRelations)
+            insert(rel.left, rel.right);
+    }
+
+    const_iterator insert(const Left& l, const Right& r)
+    {
+        reserve(size() + 1);
+        size_t lHash = qHash(l);
+        size_t rHash = qHash(r);
+        auto [lSlot, lFound] = mLeftIndex.probe(lHash, leftMatcher(l));
+        auto [rSlot, rFound] = mRightIndex.probe(rHash, rightMatcher(r));
+
+        if(lFound || rFound)
+        {
+            if(lFound && rFound && mLeftIndex.index(lSlot) == mRightIndex.index(rSlot))
+                return iteratorAt(mLeftIndex.index(lSlot)); // Existing relation
+
+            /* Remove to-be stale relations. This shuffles slots and storage around, so the right side
+             * has to be looked up again after the left is removed, and both sides probed again after.
+             */
+            if(lFound)
+                eraseIndex(mLeftIndex.index(lSlot));
+            if(rFound)
+                eraseIndex(rightIndex(r));
+
+            lSlot = mLeftIndex.probe(lHash, leftMatcher(l)).first;
+            rSlot = mRightIndex.probe(rHash, rightMatcher(r)).first;
+        }
+
+        qsizetype idx = mRelations.size();
+        mRelations.append(Relation{l, r, lSlot, rSlot});
+        mLeftIndex.occupy(lSlot, lHash, idx);
+        mRightIndex.occupy(rSlot, rHash, idx);
+        return iteratorAt(idx);
+    }
+
+    bool containsLeft(const Left& l) const { return leftIndex(l) != Index::npos; }
+    bool containsRight(const Right& r) const { return rightIndex(r) != Index::npos; }
+
+    Right fromLeft(const Left& l) const { return fromLeft(l, Right()); }
+
+    Right fromLeft(const Left& l, const Right& defaultValue) const
+    {
+        qsizetype idx = leftIndex(l);
+        return idx != Index::npos ? mRelations.at(idx).right : defaultValue;
+    }
+
+    Left fromRight(const Right& r) const { return fromRight(r, Left()); }
+
+    Left fromRight(const Right& r, const Left& defaultValue) const
+    {
+        qsizetype idx = rightIndex(r);
+        return idx != Index::npos ? mRelations.at(idx).left : defaultValue;
+    }
+
+    Right from(const Left& l) const requires asymmetric_bimap<Left, Right> { return fromLeft(l); }
+    Right from(const Left& l, const Right& defaultValue) const requires asymmetric_bimap<Left, Right> { return fromLeft(l, defaultValue); }
+    Left from(const Right& r) const requires asymmetric_bimap<Left, Right> { return fromRight(r); }
+    Left from(const Right& r, const Left& defaultValue) const requires asymmetric_bimap<Left, Right> { return fromRight(r, defaultValue); }
+
+    Left toLeft(const Right& r) const { return fromRight(r); }
+    Left toLeft(const Right& r, const Left& defaultValue) const { return fromRight(r, defaultValue); }
+    Right toRight(const Left& l) const { return fromLeft(l); }
+    Right toRight(const Left& l, const Right& defaultValue) const { return fromLeft(l, defaultValue); }
+
+    bool remove(const Left& l) requires asymmetric_bimap<Left, Right> { return removeLeft(l); }
+    bool remove(const Right& r) requires asymmetric_bimap<Left, Right> { return removeRight(r); }
+
+    bool removeLeft(const Left& l)
+    {
+        qsizetype idx = leftIndex(l);
+        if(idx == Index::npos)
+            return false;
+
+        eraseIndex(idx);
+        return true;
+    }
+
+    bool removeRight(const Right& r)
+    {
+        qsizetype idx = rightIndex(r);
+        if(idx == Index::npos)
+            return false;
+
+        eraseIndex(idx);
+        return true;
+    }
+
+    template<typename Predicate>
+        requires flatbimap_predicate<Left, Right, Predicate>
+    qsizetype removeIf(Predicate pred)
+    {
+        // Single compacting pass, which also preserves the relative order of the remaining relations
+        qsizetype write = 0;
+        for(qsizetype read = 0; read < mRelations.size(); ++read)
+        {
+            const Relation& rel = mRelations.at(read);
+            bool remove;
+            if constexpr(flatbimap_iterator_predicate<Left, Right, Predicate>)
+                remove = pred(const_iterator(mRelations.cbegin() + read));
+            else
+                remove = pred(std::pair<const Left&, const Right&>(rel.left, rel.right));
+
+            if(remove)
+            {
+                mLeftIndex.vacate(rel.leftSlot, leftRelocator());
+                mRightIndex.vacate(rel.rightSlot, rightRelocator());
+            }
+            else
+            {
+                if(write != read)
+                    mRelations[write] = std::move(mRelations[read]);
+                const Relation& kept = mRelations.at(write);
+                mLeftIndex.setIndex(kept.leftSlot, write);
+                mRightIndex.setIndex(kept.rightSlot, write);
+                ++write;
+            }
+        }
+
+        qsizetype removed = mRelations.size() - write;
+        mRelations.remove(write, removed);
+        return removed;
+    }
+
+    Right takeRight(const Left& l)
+    {
+        qsizetype idx = leftIndex(l);
+        if(idx == Index::npos)
+            return Right();
+
+        Right r = mRelations.at(idx).right;
+        eraseIndex(idx);
+        return r;
+    }
+
+    Left takeLeft(const Right& r)
+    {
+        qsizetype idx = rightIndex(r);
+        if(idx == Index::npos)
+            return Left();
+
+        Left l = mRelations.at(idx).left;
+        eraseIndex(idx);
+        return l;
+    }
+
+    Right take(const Left& l) requires asymmetric_bimap<Left, Right> { return takeRight(l); }
+    Left take(const Right& r) requires asymmetric_bimap<Left, Right> { return takeLeft(r); }
+
+    void swap(FlatBimap& other)
+    {
+        mRelations.swap(other.mRelations);
+        mLeftIndex.swap(other.mLeftIndex);
+        mRightIndex.swap(other.mRightIndex);
+    }
+
+    qsizetype size() const { return mRelations.size(); }
+    qsizetype count() const { return size(); }
+    bool isEmpty() const { return size() == 0; }
+    bool empty() const { return isEmpty(); }
+    float load_factor() const { return mLeftIndex.slotCount() ? float(size()) / float(mLeftIndex.slotCount()) : 0.0f; }
+
+    qsizetype capacity() const { return mRelations.capacity(); }
+    void clear() { mRelations.clear(); mLeftIndex.clear(); mRightIndex.clear(); }
+
+    void reserve(qsizetype size)
+    {
+        mRelations.reserve(size);
+        mLeftIndex.reserve(size, leftRelocator());
+        mRightIndex.reserve(size, rightRelocator());
+    }
+
+    void rehash(qsizetype size)
+    {
+        mLeftIndex.rehash(size, leftRelocator());
+        mRightIndex.rehash(size, rightRelocator());
+    }
+
+    void squeeze()
+    {
+        mRelations.squeeze();
+        rehash(0);
+    }
+
+    QList<Left> lefts() const
+    {
+        QList<Left> ls;
+        ls.reserve(size());
+        for(const Relation& rel : mRelations)
+            ls.append(rel.left);
+        return ls;
+    }
+
+    QList<Right> rights() const
+    {
+        QList<Right> rs;
+        rs.reserve(size());
+        for(const Relation& rel : mRelations)
+            rs.append(rel.right);
+        return rs;
+    }
+
+    // Doc'ed here cause doxygen struggles with this one being separate
+    /*!
+     *  Returns a list containing all of relationships in the bimap, in insertion order, unless
+     *  relationships have been removed, in which case the order is arbitrary.
+     *
+     *  This function creates a new list, in linear time.  The time and memory use that entails can be avoided
+     *  by iterating from begin() to end().
+     *
+     *  @sa lefts() and rights().
+     */
+    QList<std::pair<Left, Right>> relationships() const
+    {
+        QList<std::pair<Left, Right>> rel;
+        rel.reserve(size());
+        for(const Relation& r : mRelations)
+            rel.append(std::make_pair(r.left, r.right));
+        return rel;
+    }
+
+//-Operators---------------------------------------------------------------------------------------------
+public:
+    Right operator[](const Left& l) const requires asymmetric_bimap<Left, Right>
+    {
+        qsizetype idx = leftIndex(l);
+        if(idx == Index::npos)
+            throw std::invalid_argument("Access into bimap with a value it does not contain!");
+        return mRelations.at(idx).right;
+    }
+
+    Left operator[](const Right& r) const requires asymmetric_bimap<Left, Right>
+    {
+        qsizetype idx = rightIndex(r);
+        if(idx == Index::npos)
+            throw std::invalid_argument("Access into bimap with a value it does not contain!");
+        return mRelations.at(idx).left;
+    }
+
+    bool operator==(const FlatBimap& other) const
+    {
+        if(size() != other.size())
+            return false;
+
+        for(const Relation& rel : mRelations)
+        {
+            qsizetype oIdx = other.leftIndex(rel.left);
+            if(oIdx == Index::npos || other.mRelations.at(oIdx).right != rel.right)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool operator!=(const FlatBimap& other) const = default;
+};
+
+// Doc'ed here cause doxygen struggles with this one being separate
+/*!
+ *  Removes all elements for which the predicate pred returns true from the flat bimap.
+ *
+ *  The function supports predicates which take either an argument of type FlatBimap<Left, Right>::const_iterator,
+ *  or an argument of type std::pair<const Left&, const Right&>.
+ *
+ *  Returns the number of elements removed, if any.
+ */
+template<typename Left, typename Right, typename Predicate>
+    requires flatbimap_predicate<Left, Right, Predicate>
+qsizetype erase_if(FlatBimap<Left, Right>& flatbimap, Predicate pred) { return flatbimap.removeIf(pred); }
+
+}
+
+#endif // QX_FLATBIMAP_H
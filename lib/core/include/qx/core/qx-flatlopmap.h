@@ -0,0 +1,539 @@
+#ifndef QX_FLATLOPMAP_H
+#define QX_FLATLOPMAP_H
+
+// Standard Library Includes
+#include <algorithm>
+#include <functional>
+
+// Qt Includes
+#include <QHash>
+#include <QList>
+
+// Intra-component Includes
+#include "qx/core/__private/qx-hashindex.h"
+
+// Extra-component Includes
+#include <qx/utility/qx-concepts.h>
+
+namespace Qx
+{
+
+template<typename Key, typename T, typename Compare = std::less<T>>
+    requires std::predicate<Compare, T, T>
+class FlatLopmap;
+
+template<typename Key, typename T, typename Compare, typename Predicate>
+concept flatlopmap_iterator_predicate = defines_call_for_s<Predicate, bool, typename FlatLopmap<Key, T, Compare>::const_iterator>;
+
+template<typename Key, typename T, typename Predicate>
+concept flatlopmap_pair_predicate = defines_call_for_s<Predicate, bool, std::pair<const Key&, const T&>>;
+
+template<typename Key, typename T, typename Compare, typename Predicate>
+concept flatlopmap_predicate = flatlopmap_iterator_predicate<Key, T, Compare, Predicate> || flatlopmap_pair_predicate<Key, T, Predicate>;
+
+template<typename Key, typename T, typename Compare>
+    requires std::predicate<Compare, T, T>
+class FlatLopmap
+{
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    struct Data
+    {
+        Key key;
+        T value;
+        qsizetype slot;
+    };
+
+//-Aliases----------------------------------------------------------------------------------------------------------
+private:
+    using StorageContainer = QList<Data>;
+    using StorageItr = typename StorageContainer::const_iterator;
+    using StorageRevItr = typename StorageContainer::const_reverse_iterator;
+    using Index = _QxPrivate::HashIndex;
+
+public:
+    class const_iterator
+    {
+        friend class FlatLopmap<Key, T, Compare>;
+    //-Aliases------------------------------------------------------------------------------------------------------
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+
+    //-Instance Variables-------------------------------------------------------------------------------------------
+    private:
+        StorageItr mStorageItr;
+
+    //-Constructor--------------------------------------------------------------------------------------------------
+    private:
+        const_iterator(const StorageItr& sItr) : mStorageItr(sItr) {}
+
+    public:
+        const_iterator() {}
+
+    //-Instance Functions-------------------------------------------------------------------------------------------
+    public:
+        const Key& key() const { return mStorageItr->key; }
+        const T& value() const { return mStorageItr->value; }
+
+    //-Operators---------------------------------------------------------------------------------------------
+    public:
+        bool operator==(const const_iterator& other) const = default;
+        const T& operator*() const { return value(); }
+        const_iterator& operator++() { mStorageItr++; return *this; }
+
+        const_iterator operator++(int)
+        {
+            auto cur = *this;
+            mStorageItr++;
+            return cur;
+        }
+
+        const_iterator& operator--() { mStorageItr--; return *this; }
+
+        const_iterator operator--(int)
+        {
+            auto cur = *this;
+            mStorageItr--;
+            return cur;
+        }
+
+        const T* operator->() const { return &mStorageItr->value; }
+    };
+
+    class const_reverse_iterator
+    {
+/*! @cond */
+        friend class FlatLopmap<Key, T, Compare>;
+    //-Aliases------------------------------------------------------------------------------------------------------
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+
+    //-Instance Variables-------------------------------------------------------------------------------------------
+    private:
+        StorageRevItr mStorageItr;
+
+    //-Constructor--------------------------------------------------------------------------------------------------
+    private:
+        const_reverse_iterator(const StorageRevItr& sItr) : mStorageItr(sItr) {}
+
+    public:
+        const_reverse_iterator() {}
+
+    //-Instance Functions-------------------------------------------------------------------------------------------
+    public:
+        const Key& key() const { return mStorageItr->key; }
+        const T& value() const { return mStorageItr->value; }
+
+    //-Operators---------------------------------------------------------------------------------------------
+    public:
+        bool operator==(const const_reverse_iterator& other) const = default;
+        const T& operator*() const { return value(); }
+        const_reverse_iterator& operator++() { mStorageItr++; return *this; }
+
+        const_reverse_iterator operator++(int)
+        {
+            auto cur = *this;
+            mStorageItr++;
+            return cur;
+        }
+
+        const_reverse_iterator& operator--() { mStorageItr--; return *this; }
+
+        const_reverse_iterator operator--(int)
+        {
+            auto cur = *this;
+            mStorageItr--;
+            return cur;
+        }
+
+        const T* operator->() const { return &mStorageItr->value; }
+/*! @endcond */
+    };
+
+//-Aliases (cont.)-------------------------------------------------------------------------------------------------
+public:
+    using iterator = const_iterator;
+    using ConstIterator = const_iterator;
+    using Iterator = iterator;
+    using reverse_iterator = const_reverse_iterator;
+    using ConstReverseIterator = const_reverse_iterator;
+    using ReverseIterator = reverse_iterator;
+    using difference_type = typename StorageContainer::difference_type;
+    using key_type = Key;
+    using mapped_Type = T;
+    using size_type = typename StorageContainer::size_type;
+    using value_compare = Compare;
+
+//-Instance Variables-------------------------------------------------------------------------------------------
+private:
+    Compare mCompare;
+    StorageContainer mStorage;
+    Index mIndex;
+
+//-Constructor--------------------------------------------------------------------------------------------------
+public:
+    FlatLopmap() {}
+
+    FlatLopmap(std::initializer_list<std::pair<Key, T>> list)
+    {
+        reserve(list.size());
+        for(auto it = list.begin(); it != list.end(); ++it)
+            insert(it->first, it->second);
+    }
+
+//-Instance Functions-------------------------------------------------------------------------------------------
+private:
+    static size_t hash(const Key& key) { return qHash(key); }
+
+    auto slotRelocator() { return [this](qsizetype idx, qsizetype slot){ mStorage[idx].slot = slot; }; }
+    auto keyMatcher(const Key& key) const { return [this, &key](qsizetype idx){ return mStorage.at(idx).key == key; }; }
+
+    qsizetype lookupIndex(const Key& key) const
+    {
+        qsizetype slot = mIndex.find(hash(key), keyMatcher(key));
+        return slot != Index::npos ? mIndex.index(slot) : Index::npos;
+    }
+
+    StorageItr lookupStorage(const Key& key) const
+    {
+        qsizetype idx = lookupIndex(key);
+        return idx != Index::npos ? mStorage.cbegin() + idx : mStorage.cend();
+    }
+
+    void syncIndices(qsizetype first, qsizetype last)
+    {
+        // Points the slots of elements within [first, last) back at their (shifted) positions
+        for(qsizetype i = first; i < last; ++i)
+            mIndex.setIndex(mStorage.at(i).slot, i);
+    }
+
+    bool validHint(qsizetype hint, const T& value, qsizetype first, qsizetype last) const
+    {
+        // Valid if (hint - 1) <= value <= hint within [first, last)
+        return hint >= first && hint <= last &&
+               (hint == first || !mCompare(value, mStorage.at(hint - 1).value)) &&
+               (hint == last || !mCompare(mStorage.at(hint).value, value));
+    }
+
+    qsizetype insertPosition(const T& value, qsizetype hint, qsizetype first, qsizetype last) const
+    {
+        // Like std::multiset, equal values are placed after existing ones unless a valid hint says otherwise
+        if(hint != Index::npos && validHint(hint, value, first, last))
+            return hint;
+
+        auto cmp = [this](const T& v, const Data& d){ return mCompare(v, d.value); };
+        return std::upper_bound(mStorage.cbegin() + first, mStorage.cbegin() + last, value, cmp) - mStorage.cbegin();
+    }
+
+    qsizetype reposition(qsizetype idx, const T& value, qsizetype hint)
+    {
+        /* Moves an existing element to where its new value belongs by rotating it through the elements
+         * in between, which only touches that span instead of the entire tail like erase + insert would.
+         */
+        qsizetype target;
+        if(mCompare(value, mStorage.at(idx).value))
+        {
+            target = insertPosition(value, hint, 0, idx);
+            auto b = mStorage.begin();
+            std::rotate(b + target, b + idx, b + idx + 1);
+            mStorage[target].value = value;
+            syncIndices(target, idx + 1);
+        }
+        else
+        {
+            target = insertPosition(value, hint, idx + 1, mStorage.size()) - 1;
+            auto b = mStorage.begin();
+            std::rotate(b + idx, b + idx + 1, b + target + 1);
+            mStorage[target].value = value;
+            syncIndices(idx, target + 1);
+        }
+
+        return target;
+    }
+
+    iterator insert_impl(const Key& key, const T& value, qsizetype hint)
+    {
+        mIndex.reserve(mStorage.size() + 1, slotRelocator());
+        size_t h = hash(key);
+        auto [slot, exists] = mIndex.probe(h, keyMatcher(key));
+
+        if(exists)
+        {
+            // Don't do anything if the value is the same as the current, to avoid iterator invalidation
+            qsizetype idx = mIndex.index(slot);
+            if(mStorage.at(idx).value == value)
+                return iterator(mStorage.cbegin() + idx);
+
+            return iterator(mStorage.cbegin() + reposition(idx, value, hint));
+        }
+
+        // Store the new data and shift the indices of everything after it
+        qsizetype idx = insertPosition(value, hint, 0, mStorage.size());
+        mStorage.insert(idx, Data{key, value, slot});
+        mIndex.occupy(slot, h, idx);
+        syncIndices(idx + 1, mStorage.size());
+
+        return iterator(mStorage.cbegin() + idx);
+    }
+
+    void eraseIndex(qsizetype idx) { mIndex.vacate(mStorage.at(idx).slot, slotRelocator()); }
+
+public:
+    iterator begin() { return constBegin(); }
+    const_iterator begin() const { return constBegin(); }
+    const_iterator cbegin() const { return constBegin(); }
+    const_iterator constBegin() const { return const_iterator(mStorage.cbegin()); }
+    iterator end() { return constEnd(); }
+    const_iterator end() const { return constEnd(); }
+    const_iterator cend() const { return constEnd(); }
+    const_iterator constEnd() const { return const_iterator(mStorage.cend()); }
+    reverse_iterator rbegin() { return constReverseBegin(); }
+    const_reverse_iterator rbegin() const { return constReverseBegin(); }
+    const_reverse_iterator crbegin() const { return constReverseBegin(); }
+    const_reverse_iterator constReverseBegin() const { return const_reverse_iterator(mStorage.crbegin()); }
+    reverse_iterator rend() { return constReverseEnd(); }
+    const_reverse_iterator rend() const { return constReverseEnd(); }
+    const_reverse_iterator crend() const { return constReverseEnd(); }
+    const_reverse_iterator constReverseEnd() const { return const_reverse_iterator(mStorage.crend()); }
+
+    iterator find(const Key& key) { return constFind(key); }
+    const_iterator find(const Key& key) const { return constFind(key); }
+    const_iterator constFind(const Key& key) const { return const_iterator(lookupStorage(key)); }
+    iterator lowerBound(const T& value) { return std::as_const(*this).lowerBound(value); }
+
+    const_iterator lowerBound(const T& value) const
+    {
+        auto cmp = [this](const Data& d, const T& v){ return mCompare(d.value, v); };
+        return const_iterator(std::lower_bound(mStorage.cbegin(), mStorage.cend(), value, cmp));
+    }
+
+    iterator upperBound(const T& value) { return std::as_const(*this).upperBound(value); }
+
+    const_iterator upperBound(const T& value) const
+    {
+        auto cmp = [this](const T& v, const Data& d){ return mCompare(v, d.value); };
+        return const_iterator(std::upper_bound(mStorage.cbegin(), mStorage.cend(), value, cmp));
+    }
+
+    std::pair<iterator, iterator> equal_range(const T& value) { return std::as_const(*this).equal_range(value); }
+    std::pair<const_iterator, const_iterator> equal_range(const T& value) const { return std::make_pair(lowerBound(value), upperBound(value)); }
+
+    const T& first() const { Q_ASSERT(!mStorage.isEmpty()); return mStorage.constFirst().value; }
+    const Key& firstKey() const { Q_ASSERT(!mStorage.isEmpty()); return mStorage.constFirst().key; }
+
+    const T& last() const { Q_ASSERT(!mStorage.isEmpty()); return mStorage.constLast().value; }
+    const Key& lastKey() const { Q_ASSERT(!mStorage.isEmpty()); return mStorage.constLast().key; }
+
+    Key key(const T& value, const Key& defaultKey = Key()) const
+    {
+        for(const auto& data : mStorage)
+            if(data.value == value)
+                return data.key;
+
+        return defaultKey;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        Q_ASSERT(pos != constEnd());
+        qsizetype idx = pos.mStorageItr - mStorage.cbegin();
+        eraseIndex(idx);
+        mStorage.remove(idx);
+        syncIndices(idx, mStorage.size());
+        return iterator(mStorage.cbegin() + idx);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        qsizetype fIdx = first.mStorageItr - mStorage.cbegin();
+        qsizetype lIdx = last.mStorageItr - mStorage.cbegin();
+        Q_ASSERT(fIdx <= lIdx);
+
+        for(qsizetype i = fIdx; i < lIdx; ++i)
+            eraseIndex(i);
+        mStorage.remove(fIdx, lIdx - fIdx);
+        syncIndices(fIdx, mStorage.size());
+
+        return iterator(mStorage.cbegin() + fIdx);
+    }
+
+    void insert(FlatLopmap&& other)
+    {
+        if(isEmpty())
+        {
+            swap(other);
+            return;
+        }
+
+        insert(std::as_const(other));
+        other.clear();
+    }
+
+    void insert(const FlatLopmap& other)
+    {
+        if(this == &other)
+            return;
+
+        reserve(size() + other.size());
+        for(const auto& data : other.mStorage)
+            insert(data.key, data.value);
+    }
+
+    iterator insert(const Key& key, const T& value) { return insert_impl(key, value, Index::npos); }
+    iterator insert(const_iterator pos, const Key& key, const T& value) { return insert_impl(key, value, pos.mStorageItr - mStorage.cbegin()); }
+    bool contains(const Key& key) const { return lookupIndex(key) != Index::npos; }
+
+    size_type remove(const Key& key)
+    {
+        qsizetype idx = lookupIndex(key);
+        if(idx != Index::npos)
+        {
+            erase(const_iterator(mStorage.cbegin() + idx));
+            return 1;
+        }
+
+        return 0;
+    }
+
+    template<typename Predicate>
+        requires flatlopmap_predicate<Key, T, Compare, Predicate>
+    qsizetype removeIf(Predicate pred)
+    {
+        // Single compacting pass, so that the tail only has to be shifted and re-indexed once
+        qsizetype write = 0;
+        for(qsizetype read = 0; read < mStorage.size(); ++read)
+        {
+            bool remove;
+            if constexpr(flatlopmap_iterator_predicate<Key, T, Compare, Predicate>)
+                remove = pred(const_iterator(mStorage.cbegin() + read));
+            else
+                remove = pred(std::pair<const Key&, const T&>(mStorage.at(read).key, mStorage.at(read).value));
+
+            if(remove)
+                eraseIndex(read);
+            else
+            {
+                if(write != read)
+                    mStorage[write] = std::move(mStorage[read]);
+                mIndex.setIndex(mStorage.at(write).slot, write);
+                ++write;
+            }
+        }
+
+        qsizetype removed = mStorage.size() - write;
+        mStorage.remove(write, removed);
+        return removed;
+    }
+
+    T take(const Key& key)
+    {
+        qsizetype idx = lookupIndex(key);
+        if(idx != Index::npos)
+        {
+            T t = mStorage.at(idx).value;
+            erase(const_iterator(mStorage.cbegin() + idx));
+            return t;
+        }
+
+        return T();
+    }
+
+    void swap(FlatLopmap& other)
+    {
+        std::swap(mCompare, other.mCompare);
+        mStorage.swap(other.mStorage);
+        mIndex.swap(other.mIndex);
+    }
+
+    qsizetype size() const { return mStorage.size(); }
+    qsizetype count() const { return size(); }
+    bool isEmpty() const { return size() == 0; }
+    bool empty() const { return isEmpty(); }
+
+    qsizetype capacity() const { return mStorage.capacity(); }
+
+    void reserve(qsizetype size)
+    {
+        mStorage.reserve(size);
+        mIndex.reserve(size, slotRelocator());
+    }
+
+    void squeeze()
+    {
+        mStorage.squeeze();
+        mIndex.rehash(mStorage.size(), slotRelocator());
+    }
+
+    void clear() { mIndex.clear(); mStorage.clear(); }
+
+    T value(const Key& key, const T& defaultValue = T()) const
+    {
+        qsizetype idx = lookupIndex(key);
+        return idx != Index::npos ? mStorage.at(idx).value : defaultValue;
+    }
+
+    QList<Key> keys() const
+    {
+        QList<Key> ks;
+        ks.reserve(mStorage.size());
+        for(const auto& data : mStorage)
+            ks.append(data.key);
+        return ks;
+    }
+
+    QList<Key> keys(const T& value) const
+    {
+        QList<Key> ks;
+        for(const auto& data : mStorage)
+            if(data.value == value)
+                ks.append(data.key);
+        return ks;
+    }
+
+    QList<T> values() const
+    {
+        QList<T> vs;
+        vs.reserve(mStorage.size());
+        for(const auto& data : mStorage)
+            vs.append(data.value);
+        return vs;
+    }
+
+//-Operators---------------------------------------------------------------------------------------------
+public:
+    T operator[](const Key& key) const { return value(key); }
+
+    bool operator==(const FlatLopmap& other) const
+    {
+        if(size() != other.size())
+            return false;
+
+        for(const auto& data : mStorage)
+        {
+            qsizetype oIdx = other.lookupIndex(data.key);
+            if(oIdx == Index::npos || !(other.mStorage.at(oIdx).value == data.value))
+                return false;
+        }
+
+        return true;
+    }
+
+    bool operator!=(const FlatLopmap& other) const = default;
+};
+
+// Doc'ed here cause doxygen struggles with this one being separate
+/*!
+ *  Removes all elements for which the predicate pred returns true from the flat lopmap.
+ *
+ *  The function supports predicates which take either an argument of type FlatLopmap<Key, T, Compare>::const_iterator,
+ *  or an argument of type std::pair<const Key&, const T&>.
+ *
+ *  Returns the number of elements removed, if any.
+ */
+template<typename Key, typename T, typename Compare, typename Predicate>
+    requires flatlopmap_predicate<Key, T, Compare, Predicate>
+qsizetype erase_if(FlatLopmap<Key, T, Compare>& flatlopmap, Predicate pred) { return flatlopmap.removeIf(pred); }
+
+}
+
+#endif // QX_FLATLOPMAP_H
@@ -4,6 +4,7 @@
 // Standard Library Includes
 #include <concepts>
 #include <algorithm>
+#include <iterator>
 
 // Qt Includes
 #include <QList>
@@ -88,35 +89,53 @@ private:
 public:
     FlatMultiSet() = default;
 
-    FlatMultiSet(std::initializer_list<T> list)
-    {
-        mContainer.reserve(list.size());
-        for(const auto& e : list)
-            insert(e);
-    }
+    FlatMultiSet(std::initializer_list<T> list) : FlatMultiSet(list.begin(), list.end()) {}
 
     template<std::input_iterator InputIterator>
     FlatMultiSet(InputIterator first, InputIterator last)
     {
-        mContainer.reserve(std::distance(first, last));
-        while(first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        /* Appending everything and then sorting once is O(N log N), whereas inserting each element
+         * individually is O(N^2) due to the shifting. A stable sort keeps equivalent elements in the
+         * same order they would have ended up in via insert().
+         */
+        if constexpr(std::forward_iterator<InputIterator>)
+            mContainer.reserve(std::distance(first, last));
+        std::copy(first, last, std::back_inserter(mContainer));
+        std::stable_sort(mContainer.begin(), mContainer.end(), mCompare);
     }
 
+//-Instance Functions----------------------------------------------------------------------------------------------
+private:
+    void mergeTail(qsizetype tailStart)
+    {
+        // Merges the sorted range [tailStart, end) into the sorted range that precedes it
+        if(tailStart == 0 || tailStart == mContainer.size() || !mCompare(mContainer.at(tailStart), mContainer.at(tailStart - 1)))
+            return; // Already in order
+
+        auto b = mContainer.begin();
+        std::inplace_merge(b, b + tailStart, mContainer.end(), mCompare);
+    }
+
+public:
     // Query/Info
     bool contains(const FlatMultiSet& other) const
     {
+        // Both are sorted, so a single linear pass over each is sufficient
+        auto itr = cbegin();
+        const auto end = cend();
         for(const auto& e : other)
-            if(!contains(e))
+        {
+            while(itr != end && mCompare(*itr, e))
+                ++itr;
+
+            if(itr == end || mCompare(e, *itr))
                 return false;
+        }
 
         return true;
     }
 
-    bool contains(const T& value) const { return std::binary_search(cbegin(), cend(), value); }
+    bool contains(const T& value) const { return std::binary_search(cbegin(), cend(), value, mCompare); }
     qsizetype count() const { return size(); }
     qsizetype size() const { return mContainer.size(); }
     bool empty() const { return isEmpty(); }
@@ -166,7 +185,7 @@ public:
             else if(mCompare(value, *mid))
                 last = mid;  // Nudge towards lower bound
             else
-                mid;  // Match
+                return mid;  // Match
         }
 
         return cend();  // No match
@@ -176,7 +195,7 @@ public:
 
     std::pair<const_iterator, const_iterator> equal_range(const T& value) const
     {
-        return std::make_pair(lowerBound(), upperBound());
+        return std::make_pair(lowerBound(value), upperBound(value));
     }
 
     const_iterator lowerBound(const T& value) const { return std::lower_bound(cbegin(), cend(), value, mCompare); }
@@ -192,7 +211,7 @@ public:
     iterator emplace(Args&&... args)
     {
         T value(std::forward<Args>(args)...);
-        mContainer.insert(upperBound(value), std::move(value));
+        return mContainer.insert(upperBound(value), std::move(value));
     }
 
     template<typename ...Args>
@@ -220,6 +239,36 @@ public:
         return mContainer.insert(pos, std::move(value));
     }
 
+    template<std::input_iterator InputIterator>
+    void insertRange(InputIterator first, InputIterator last)
+    {
+        // Sort the new elements on their own, then merge them in with one linear pass
+        qsizetype tailStart = mContainer.size();
+        if constexpr(std::forward_iterator<InputIterator>)
+            mContainer.reserve(tailStart + std::distance(first, last));
+        std::copy(first, last, std::back_inserter(mContainer));
+
+        auto b = mContainer.begin();
+        std::stable_sort(b + tailStart, mContainer.end(), mCompare);
+        mergeTail(tailStart);
+    }
+
+    void merge(const FlatMultiSet& other)
+    {
+        if(other.isEmpty())
+            return;
+
+        if(isEmpty())
+        {
+            mContainer = other.mContainer;
+            return;
+        }
+
+        qsizetype tailStart = mContainer.size();
+        mContainer.append(other.mContainer);
+        mergeTail(tailStart);
+    }
+
     //FlatMultiSet& intersect(const FlatMultiSet& other); // Quetionable for multi-set
 
     qsizetype remove(const T& value)
@@ -227,7 +276,7 @@ public:
         qsizetype removed = 0;
 
         auto itr = lowerBound(value);
-        while(*itr == value)
+        while(itr != cend() && *itr == value)
         {
             itr = erase(itr);
             ++removed;
@@ -249,7 +298,7 @@ public:
     QList<T> values() const { return mContainer; };
 
     // Operators
-    inline bool operator==(const FlatMultiSet& other) const = default;
+    inline bool operator==(const FlatMultiSet& other) const { return mContainer == other.mContainer; }
 
     // These don't necessarily make sense for a multi-set
     // inline FlatMultiSet& operator&=(const FlatMultiSet& other) { return intersect(other); }
@@ -4,10 +4,15 @@
 // Shared Lib Support
 #include "qx/core/qx_core_export.h"
 
+// Standard Library Includes
+#include <optional>
+
 // Qt Includes
 #include <QString>
 #include <QCryptographicHash>
 
+class QIODevice;
+
 namespace Qx
 {
 
@@ -17,7 +22,64 @@ class QX_CORE_EXPORT Integrity
 public:
     static QString generateChecksum(QByteArray& data, QCryptographicHash::Algorithm hashAlgorithm);
     static quint32 crc32(QByteArrayView data);
-};	
+};
+
+class QX_CORE_EXPORT Crc32
+{
+//-Instance Variables-------------------------------------------------------------------------------------------
+private:
+    quint32 mRegister;
+    qint64 mLength;
+
+//-Constructor--------------------------------------------------------------------------------------------------
+public:
+    Crc32();
+
+//-Class Functions---------------------------------------------------------------------------------------------
+public:
+    static quint32 combine(quint32 crc1, quint32 crc2, qint64 length2);
+
+//-Instance Functions------------------------------------------------------------------------------------------
+public:
+    void update(QByteArrayView data);
+    void combine(const Crc32& following);
+    void reset();
+
+    quint32 finalize() const;
+    qint64 length() const;
+};
+
+class QX_CORE_EXPORT Hasher
+{
+//-Class Enums--------------------------------------------------------------------------------------------------
+public:
+    enum ChecksumAlgorithm { CRC32 };
+
+//-Class Variables----------------------------------------------------------------------------------------------
+private:
+    static constexpr qint64 DEVICE_CHUNK_SIZE = 64 * 1024;
+
+//-Instance Variables-------------------------------------------------------------------------------------------
+private:
+    std::optional<QCryptographicHash> mCryptoHash;
+    Crc32 mCrc;
+
+//-Constructor--------------------------------------------------------------------------------------------------
+public:
+    explicit Hasher(QCryptographicHash::Algorithm algorithm);
+    explicit Hasher(ChecksumAlgorithm algorithm);
+    explicit Hasher(const Crc32& crc);
+
+//-Instance Functions------------------------------------------------------------------------------------------
+public:
+    bool isCrc32() const;
+
+    void addData(QByteArrayView data);
+    bool addData(QIODevice* device);
+    void reset();
+
+    QByteArray result() const;
+};
 
 }
 
@@ -0,0 +1,72 @@
+#ifndef QX_STRINGMAPPER_H
+#define QX_STRINGMAPPER_H
+
+// Shared Lib Support
+#include "qx/core/qx_core_export.h"
+
+// Qt Includes
+#include <QAnyStringView>
+#include <QList>
+#include <QMap>
+#include <QString>
+
+namespace Qx
+{
+
+class QX_CORE_EXPORT StringMapper
+{
+//-Class Variables-------------------------------------------------------------------------------------------------
+private:
+    static constexpr char16_t ROOT_TABLE_SIZE = 256;
+
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    struct Edge
+    {
+        char16_t ch;
+        qsizetype target;
+    };
+
+    struct Node
+    {
+        qsizetype firstEdge = 0;
+        qsizetype edgeCount = 0;
+        qsizetype fail = 0;
+        qsizetype depth = 0;
+        qsizetype matchLength = 0; // Length of the longest key that is a suffix of this node's path, 0 if none
+        qsizetype matchReplacement = -1;
+    };
+
+//-Instance Variables-------------------------------------------------------------------------------------------
+private:
+    Qt::CaseSensitivity mCaseSensitivity;
+    QList<Node> mNodes;
+    QList<Edge> mEdges;
+    QList<qsizetype> mRootTable;
+    QList<QString> mReplacements;
+
+//-Constructor--------------------------------------------------------------------------------------------------
+public:
+    StringMapper();
+    StringMapper(const QMap<QString, QString>& map, Qt::CaseSensitivity cs = Qt::CaseSensitive);
+
+//-Instance Functions-------------------------------------------------------------------------------------------
+private:
+    char16_t unit(char16_t ch) const;
+    qsizetype edge(qsizetype node, char16_t ch) const;
+    qsizetype step(qsizetype node, char16_t ch) const;
+
+    template<typename Char, typename Report>
+    void scan(const Char* chars, qsizetype length, Report report) const;
+
+public:
+    bool isEmpty() const;
+    qsizetype count() const;
+    Qt::CaseSensitivity caseSensitivity() const;
+
+    QString map(QAnyStringView s) const;
+};
+
+}
+
+#endif // QX_STRINGMAPPER_H
@@ -1,6 +1,13 @@
 #ifndef QX_TABLE_H
 #define QX_TABLE_H
 
+// Standard Library Includes
+#include <algorithm>
+#include <compare>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
 // Qt Includes
 #include <QList>
 #include <QSize>
@@ -11,91 +18,378 @@ namespace Qx
 template<typename T>
 class Table
 {
+//-Class Enums----------------------------------------------------------------------------------------------
+public:
+    enum Layout
+    {
+        RowMajor,
+        ColumnMajor
+    };
+
+//-Inner Classes--------------------------------------------------------------------------------------------
+public:
+    template<typename E>
+    class strided_view
+    {
+    //-Iterators-----------------------------------------------------------------------------------------------
+    public:
+        class iterator
+        {
+            friend class strided_view;
+        //-Aliases-----------------------------------------------------------------------------------------------
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using difference_type = qsizetype;
+            using value_type = std::remove_const_t<E>;
+            using pointer = E*;
+            using reference = E&;
+
+        //-Instance Variables----------------------------------------------------------------------------------------
+        private:
+            E* mPtr = nullptr;
+            qsizetype mStride = 1;
+
+        //-Constructor-------------------------------------------------------------------------------------------------
+        private:
+            iterator(E* ptr, qsizetype stride) : mPtr(ptr), mStride(stride) {}
+
+        public:
+            iterator() = default;
+
+        //-Operators---------------------------------------------------------------------------------------------------
+        public:
+            bool operator==(const iterator& other) const { return mPtr == other.mPtr; }
+            std::strong_ordering operator<=>(const iterator& other) const { return mPtr <=> other.mPtr; }
+            E& operator*() const { return *mPtr; }
+            E* operator->() const { return mPtr; }
+            E& operator[](difference_type n) const { return mPtr[n * mStride]; }
+            iterator& operator++() { mPtr += mStride; return *this; }
+            iterator operator++(int) { iterator it = *this; mPtr += mStride; return it; }
+            iterator& operator--() { mPtr -= mStride; return *this; }
+            iterator operator--(int) { iterator it = *this; mPtr -= mStride; return it; }
+            iterator& operator+=(difference_type n) { mPtr += n * mStride; return *this; }
+            iterator& operator-=(difference_type n) { mPtr -= n * mStride; return *this; }
+            friend iterator operator+(iterator it, difference_type n) { return it += n; }
+            friend iterator operator+(difference_type n, iterator it) { return it += n; }
+            friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+            difference_type operator-(const iterator& other) const { return (mPtr - other.mPtr) / mStride; }
+        };
+
+    //-Instance Variables----------------------------------------------------------------------------------------
+    private:
+        E* mData = nullptr;
+        qsizetype mSize = 0;
+        qsizetype mStride = 1;
+
+    //-Constructor-------------------------------------------------------------------------------------------------
+    public:
+        strided_view() = default;
+        strided_view(E* data, qsizetype size, qsizetype stride) : mData(data), mSize(size), mStride(stride) {}
+
+    //-Instance Functions----------------------------------------------------------------------------------------------
+    public:
+        E& at(qsizetype i) const
+        {
+            Q_ASSERT_X(size_t(i) < size_t(mSize), Q_FUNC_INFO, "index out of range");
+            return mData[i * mStride];
+        }
+
+        iterator begin() const { return iterator(mData, mStride); }
+        iterator end() const { return iterator(mData + mSize * mStride, mStride); }
+        E* data() const { return mData; }
+        E& first() const { Q_ASSERT(mSize > 0); return *mData; }
+        bool isContiguous() const { return mStride == 1 || mSize < 2; }
+        bool isEmpty() const { return mSize == 0; }
+        E& last() const { Q_ASSERT(mSize > 0); return mData[(mSize - 1) * mStride]; }
+        qsizetype size() const { return mSize; }
+        qsizetype stride() const { return mStride; }
+
+        std::span<E> span() const
+        {
+            Q_ASSERT_X(isContiguous(), Q_FUNC_INFO, "view is not contiguous");
+            return std::span<E>(mData, static_cast<size_t>(mSize));
+        }
+
+        QList<std::remove_const_t<E>> toList() const
+        {
+            if(isContiguous())
+                return QList<std::remove_const_t<E>>(mData, mData + mSize);
+
+            QList<std::remove_const_t<E>> list;
+            list.reserve(mSize);
+            for(E& e : *this)
+                list.append(e);
+            return list;
+        }
+
+    //-Operators---------------------------------------------------------------------------------------------------
+    public:
+        E& operator[](qsizetype i) const { return at(i); }
+        operator strided_view<const E>() const requires (!std::is_const_v<E>) { return {mData, mSize, mStride}; }
+    };
+
+    typedef strided_view<T> view;
+    typedef strided_view<const T> const_view;
+
 //-Iterators------------------------------------------------------------------------------------------------
 public:
-    typedef typename QList<QList<T>>::const_iterator row_iterator;
+    class row_iterator
+    {
+        friend class Table;
+    //-Aliases-----------------------------------------------------------------------------------------------
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = qsizetype;
+        using value_type = const_view;
+        using reference = const_view;
+
+    //-Instance Variables----------------------------------------------------------------------------------------
+    private:
+        // Rows are tracked by index rather than address so that zero-width rows remain distinguishable
+        const T* mBase = nullptr;
+        qsizetype mRow = 0;
+        qsizetype mStep = 0;
+        qsizetype mWidth = 0;
+        qsizetype mStride = 1;
+
+    //-Constructor-------------------------------------------------------------------------------------------------
+    private:
+        row_iterator(const T* base, qsizetype row, qsizetype step, qsizetype width, qsizetype stride) :
+            mBase(base),
+            mRow(row),
+            mStep(step),
+            mWidth(width),
+            mStride(stride)
+        {}
+
+    public:
+        row_iterator() = default;
+
+    //-Operators---------------------------------------------------------------------------------------------------
+    public:
+        bool operator==(const row_iterator& other) const { return mRow == other.mRow; }
+        std::strong_ordering operator<=>(const row_iterator& other) const { return mRow <=> other.mRow; }
+        const_view operator*() const { return const_view(mBase + mRow * mStep, mWidth, mStride); }
+        const_view operator[](difference_type n) const { return *(*this + n); }
+        row_iterator& operator++() { ++mRow; return *this; }
+        row_iterator operator++(int) { row_iterator it = *this; ++mRow; return it; }
+        row_iterator& operator--() { --mRow; return *this; }
+        row_iterator operator--(int) { row_iterator it = *this; --mRow; return it; }
+        row_iterator& operator+=(difference_type n) { mRow += n; return *this; }
+        row_iterator& operator-=(difference_type n) { mRow -= n; return *this; }
+        friend row_iterator operator+(row_iterator it, difference_type n) { return it += n; }
+        friend row_iterator operator+(difference_type n, row_iterator it) { return it += n; }
+        friend row_iterator operator-(row_iterator it, difference_type n) { return it -= n; }
+        difference_type operator-(const row_iterator& other) const { return mRow - other.mRow; }
+    };
     /* TODO: Add more iterators, expects ones, as well as one that traversers each element
      * from top left to bottom right
      */
 
 //-Instance Variables---------------------------------------------------------------------------------------
 protected:
-    QList<QList<T>> mTable;
+    QList<T> mTable;
+    qsizetype mRows = 0;
+    qsizetype mColumns = 0;
+    Layout mLayout = RowMajor;
 
 //-Constructor----------------------------------------------------------------------------------------------
 public:
     Table() {}
 
-    Table(QSize size)
-    {
-        mTable.resize(size.height());
-        for(QList<T>& row : mTable)
-            row.resize(size.width());
-    }
+    Table(QSize size) :
+        mTable(qsizetype(size.width()) * size.height()),
+        mRows(size.height()),
+        mColumns(size.width())
+    {}
 
-    Table(QSize size, const T& value)
-    {
-        QList<T> row(size.width(), value);
-        mTable = QList<QList<T>>(size.height(), row);
-    }
+    Table(QSize size, const T& value) :
+        mTable(qsizetype(size.width()) * size.height(), value),
+        mRows(size.height()),
+        mColumns(size.width())
+    {}
 
     Table(std::initializer_list<std::initializer_list<T>> table)
     {
         if(table.size() == 0)
             return;
 
-        auto headerWidth = table.begin()->size();
+        qsizetype headerWidth = table.begin()->size();
+        mTable.reserve(headerWidth * table.size());
 
         for(auto itr = table.begin(); itr != table.end(); itr++)
         {
-            if(itr->size() != headerWidth)
+            if(qsizetype(itr->size()) != headerWidth)
             {
                 mTable.clear();
-                break;
+                return;
             }
 
-            mTable.append(*itr);
+            for(const T& value : *itr)
+                mTable.append(value);
         }
+
+        mRows = table.size();
+        mColumns = headerWidth;
     }
 
 //-Instance Functions----------------------------------------------------------------------------------------------
+private:
+    qsizetype rowStride() const { return mLayout == RowMajor ? mColumns : 1; }
+    qsizetype columnStride() const { return mLayout == RowMajor ? 1 : mRows; }
+    qsizetype offset(qsizetype r, qsizetype c) const { return r * rowStride() + c * columnStride(); }
+
+    /* The storage is a sequence of 'lines' (rows when row-major, columns when column-major) laid end to end.
+     * Inserting or removing whole lines is then a single block move of the trailing lines, while doing so
+     * across every line (i.e. for the other dimension) is done in one in-place pass that shifts each line
+     * by the accumulated offset, so that no operation needs more than one trip over the buffer.
+     */
+    void insertLines(qsizetype i, qsizetype n, qsizetype length)
+    {
+        if(n > 0 && length > 0)
+            mTable.insert(i * length, n * length, T());
+    }
+
+    void removeLines(qsizetype i, qsizetype n, qsizetype length)
+    {
+        if(n > 0 && length > 0)
+            mTable.remove(i * length, n * length);
+    }
+
+    void insertAcrossLines(qsizetype i, qsizetype n, qsizetype lines, qsizetype length)
+    {
+        if(n <= 0 || lines <= 0)
+            return;
+
+        qsizetype newLength = length + n;
+        mTable.resize(lines * newLength);
+        T* data = mTable.data();
+
+        // Walk backwards since every destination is at or past its source
+        for(qsizetype l = lines - 1; l >= 0; l--)
+        {
+            T* src = data + l * length;
+            T* dst = data + l * newLength;
+            std::move_backward(src + i, src + length, dst + newLength);
+            if(l > 0) // The head of the first line is already in place
+                std::move_backward(src, src + i, dst + i);
+            std::fill(dst + i, dst + i + n, T());
+        }
+    }
+
+    void removeAcrossLines(qsizetype i, qsizetype n, qsizetype lines, qsizetype length)
+    {
+        if(n <= 0 || lines <= 0)
+            return;
+
+        qsizetype newLength = length - n;
+        T* data = mTable.data();
+
+        // Walk forwards since every destination is at or before its source
+        for(qsizetype l = 0; l < lines; l++)
+        {
+            T* src = data + l * length;
+            T* dst = data + l * newLength;
+            if(l > 0) // The head of the first line is already in place
+                std::move(src, src + i, dst);
+            std::move(src + i + n, src + length, dst + i);
+        }
+
+        mTable.resize(lines * newLength);
+    }
+
+    void insertRowSpace(qsizetype i, qsizetype n)
+    {
+        if(mLayout == RowMajor)
+            insertLines(i, n, mColumns);
+        else
+            insertAcrossLines(i, n, mColumns, mRows);
+        mRows += n;
+    }
+
+    void insertColumnSpace(qsizetype i, qsizetype n)
+    {
+        if(mLayout == RowMajor)
+            insertAcrossLines(i, n, mRows, mColumns);
+        else
+            insertLines(i, n, mRows);
+        mColumns += n;
+    }
+
+    void removeRowSpace(qsizetype i, qsizetype n)
+    {
+        if(mLayout == RowMajor)
+            removeLines(i, n, mColumns);
+        else
+            removeAcrossLines(i, n, mColumns, mRows);
+        mRows -= n;
+    }
+
+    void removeColumnSpace(qsizetype i, qsizetype n)
+    {
+        if(mLayout == RowMajor)
+            removeAcrossLines(i, n, mRows, mColumns);
+        else
+            removeLines(i, n, mRows);
+        mColumns -= n;
+    }
+
+    template<typename V>
+    static void assignFrom(V view, const QList<T>& values)
+    {
+        // Fills the view with values, using default-constructed values where the list falls short
+        qsizetype n = std::min(view.size(), values.size());
+        auto itr = std::copy(values.cbegin(), values.cbegin() + n, view.begin());
+        std::fill(itr, view.end(), T());
+    }
+
 public:
     T& at(qsizetype r, qsizetype c)
     {
         Q_ASSERT_X(size_t(r) < size_t(rowCount()) && size_t(c) < size_t(columnCount()), Q_FUNC_INFO, "index out of range");
 
-        return mTable[r][c];
+        return mTable[offset(r, c)];
     }
 
     const T& at(qsizetype r, qsizetype c) const
     {
         Q_ASSERT_X(size_t(r) < size_t(rowCount()) && size_t(c) < size_t(columnCount()), Q_FUNC_INFO, "index out of range");
 
-        return mTable.at(r).at(c);
+        return mTable.at(offset(r, c));
     }
 
     QSize capacity() const
     {
-        qsizetype rowCap = mTable.capacity();
-        qsizetype colCap = !mTable.isEmpty() ? mTable.first().capacity() : 0;
+        qsizetype cap = mTable.capacity();
 
-        return QSize(rowCap, colCap);
+        if(mLayout == RowMajor)
+            return QSize(mColumns, mColumns ? cap / mColumns : 0);
+        else
+            return QSize(mRows ? cap / mRows : 0, mRows);
     }
 
-    QList<T> columnAt(qsizetype i) const
+    QList<T> columnAt(qsizetype i) const { return columnView(i).toList(); }
+
+    qsizetype columnCount() const { return mColumns; }
+
+    const_view columnView(qsizetype i) const
     {
         Q_ASSERT_X(size_t(i) < size_t(columnCount()), Q_FUNC_INFO, "index out of range");
 
-        // Build column list
-        QList<T> col;
+        return const_view(mTable.constData() + i * columnStride(), mRows, rowStride());
+    }
 
-        for(const QList<T>& row : mTable)
-            col << row[i];
+    view columnView(qsizetype i)
+    {
+        Q_ASSERT_X(size_t(i) < size_t(columnCount()), Q_FUNC_INFO, "index out of range");
 
-        return col;
+        return view(mTable.data() + i * columnStride(), mRows, rowStride());
     }
 
-    qsizetype columnCount() const { return mTable.isEmpty() ? 0 : mTable.first().size(); }
+    const T* constData() const { return mTable.constData(); }
+    const T* data() const { return mTable.constData(); }
+    T* data() { return mTable.data(); }
 
     QList<T> firstColumn() const
     {
@@ -103,7 +397,7 @@ public:
         return columnAt(0);
     }
 
-    const QList<T>& firstRow() const
+    QList<T> firstRow() const
     {
         Q_ASSERT(rowCount() > 0);
         return rowAt(0);
@@ -115,47 +409,59 @@ public:
 
     QList<T> lastColumn() const
     {
-        qsizetype height = columnCount();
-        Q_ASSERT(height > 0);
-        return rowAt(height - 1);
+        qsizetype width = columnCount();
+        Q_ASSERT(width > 0);
+        return columnAt(width - 1);
     }
 
-    const QList<T>& lastRow() const
+    QList<T> lastRow() const
     {
-        qsizetype width = rowCount();
-        Q_ASSERT(width > 0);
-        return rowAt(width - 1);
+        qsizetype height = rowCount();
+        Q_ASSERT(height > 0);
+        return rowAt(height - 1);
     }
 
-    const QList<T>& rowAt(qsizetype i) const
+    Layout layout() const { return mLayout; }
+
+    QList<T> rowAt(qsizetype i) const { return rowView(i).toList(); }
+
+    row_iterator rowBegin() const { return row_iterator(mTable.constData(), 0, rowStride(), mColumns, columnStride()); }
+
+    qsizetype rowCount() const { return mRows; }
+
+    row_iterator rowEnd() const { return row_iterator(mTable.constData(), mRows, rowStride(), mColumns, columnStride()); }
+
+    const_view rowView(qsizetype i) const
     {
-        Q_ASSERT_X(i < rowCount(), Q_FUNC_INFO, "index out of range");
+        Q_ASSERT_X(size_t(i) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
 
-        return mTable[i];
+        return const_view(mTable.constData() + i * rowStride(), mColumns, columnStride());
     }
 
-    row_iterator rowBegin() const { return mTable.constBegin(); }
-
-    qsizetype rowCount() const { return mTable.size(); }
+    view rowView(qsizetype i)
+    {
+        Q_ASSERT_X(size_t(i) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
 
-    row_iterator rowEnd() const { return mTable.constEnd(); }
+        return view(mTable.data() + i * rowStride(), mColumns, columnStride());
+    }
 
     Table section(qsizetype r, qsizetype c, qsizetype height, qsizetype width) const
     {
         // Empty shortcut: If table is already empty, or start pos would make it empty
-        if(mTable.isEmpty() || size_t(r) > size_t(mTable.size() - 1) || size_t(c) > size_t(mTable.first().size() - 1))
+        if(isEmpty() || size_t(r) >= size_t(mRows) || size_t(c) >= size_t(mColumns) || height <= 0 || width <= 0)
             return Table();
 
-        // Cap width/height to max
-        qsizetype wDelta = r + width - mTable.size();
-        qsizetype hDelta = c + height - mTable.first().size();
-        width = wDelta > 0 ? width - wDelta : width;
-        height = hDelta > 0 ? height - hDelta : height;
+        // Clamp section to table bounds
+        height = std::min(height, mRows - r);
+        width = std::min(width, mColumns - c);
 
-        Table sec;
-        sec.mTable = mTable.sliced(r, width);
-        for(QList<T>& row : sec.mTable)
-            row = row.sliced(c, height);
+        Table sec(QSize(width, height));
+        sec.mLayout = mLayout;
+        for(qsizetype i = 0; i < height; i++)
+        {
+            const_view src = rowView(r + i);
+            std::copy(src.begin() + c, src.begin() + c + width, sec.rowView(i).begin());
+        }
 
         return sec;
     }
@@ -166,46 +472,23 @@ public:
 
     T value(qsizetype r, qsizetype c, const T& defaultValue) const
     {
-        return r < rowCount() && c < columnCount() ? at(r,c) : defaultValue;
+        return size_t(r) < size_t(rowCount()) && size_t(c) < size_t(columnCount()) ? at(r,c) : defaultValue;
     }
 
     void addColumns(qsizetype c) { resizeColumns(columnCount() + c); }
 
     void addRows(qsizetype r) { resizeRows(rowCount() + r); }
 
-    void appendColumn(const QList<T>& c)
-    {
-        // If column is larger than current table height, expand it
-        if(c.size() > columnCount())
-            resizeColumns(c.size());
+    void appendColumn(const QList<T>& c) { insertColumn(columnCount(), c); }
 
-        // Add values from column, or default values if column is smaller than height
-        for(qsizetype i = 0; i < mTable.size(); i++)
-            mTable[i].append(i > c.size() - 1 ? T() : c[i]);
-    }
-
-    void appendRow(const QList<T>& r)
-    {
-        // If row is larger than current table width, expand it
-        if(r.size() > rowCount())
-            resizeRows(r.size());
-
-        // Add row
-        mTable.append(r);
-
-        // Expand row if it's smaller than the table's width
-        qsizetype width = rowCount();
-        if(r.size() < width)
-            mTable.back().resize(width);
-    }
+    void appendRow(const QList<T>& r) { insertRow(rowCount(), r); }
 
     void fill(const T& value, QSize size)
     {
         if(!size.isNull())
             resize(size);
 
-        for(QList<T>& row : mTable)
-            row.fill(value);
+        mTable.fill(value);
     }
 
     void insertColumn(qsizetype i, const QList<T>& c)
@@ -213,16 +496,19 @@ public:
         Q_ASSERT_X(i >= 0 && i <= columnCount(), "QTable<T>::insertColumn", "index out of range");
 
         // Expand height if c is larger than current height
-        qsizetype rows = rowCount();
-        if(c.size() > rows)
-        {
+        if(c.size() > rowCount())
             resizeRows(c.size());
-            rows = c.size();
-        }
 
-        // Insert values from column, or default values if column is smaller than height
-        for(qsizetype r = 0; r < rows; r++)
-            mTable[r].insert(i, r > c.size() - 1 ? T() : c[r]);
+        insertColumnSpace(i, 1);
+        assignFrom(columnView(i), c);
+    }
+
+    void insertColumns(qsizetype i, qsizetype n = 1)
+    {
+        Q_ASSERT_X(i >= 0 && i <= columnCount(), Q_FUNC_INFO, "index out of range");
+        Q_ASSERT_X(n >= 0, Q_FUNC_INFO, "invalid count");
+
+        insertColumnSpace(i, n);
     }
 
     void insertRow(qsizetype i, const QList<T>& r)
@@ -230,17 +516,19 @@ public:
         Q_ASSERT_X(i >= 0 && i <= rowCount(), "QTable<T>::insertRow", "index out of range");
 
         // Expand width if r is larger than current width
-        qsizetype columns = columnCount();
-        if(r.size() > columns)
-        {
+        if(r.size() > columnCount())
             resizeColumns(r.size());
-            columns = r.size();
-        }
 
-        // Insert row, then expand it if it's smaller than the current width
-        mTable.insert(i, r);
-        if(r.size() < columns)
-            mTable[i].resize(columns);
+        insertRowSpace(i, 1);
+        assignFrom(rowView(i), r);
+    }
+
+    void insertRows(qsizetype i, qsizetype n = 1)
+    {
+        Q_ASSERT_X(i >= 0 && i <= rowCount(), Q_FUNC_INFO, "index out of range");
+        Q_ASSERT_X(n >= 0, Q_FUNC_INFO, "invalid count");
+
+        insertRowSpace(i, n);
     }
 
     void removeColumnAt(qsizetype i) { removeColumns(i); }
@@ -253,8 +541,7 @@ public:
         if (n == 0)
             return;
 
-        for(QList<T>& row : mTable)
-            row.remove(i, n);
+        removeColumnSpace(i, n);
     }
 
     void removeRowAt(qsizetype i) { removeRows(i); }
@@ -267,7 +554,7 @@ public:
         if (n == 0)
             return;
 
-        mTable.remove(i, n);
+        removeRowSpace(i, n);
     }
 
     void removeFirstColumn()
@@ -284,60 +571,46 @@ public:
 
     void removeLastColumn()
     {
-        qsizetype height = columnCount();
-        Q_ASSERT(height > 0);
-        removeColumnAt(height - 1);
+        qsizetype width = columnCount();
+        Q_ASSERT(width > 0);
+        removeColumnAt(width - 1);
     }
 
     void removeLastRow()
     {
-        qsizetype width = rowCount();
-        Q_ASSERT(width > 0);
-        removeColumnAt(width - 1);
+        qsizetype height = rowCount();
+        Q_ASSERT(height > 0);
+        removeRowAt(height - 1);
     }
 
     void replaceColumn(qsizetype i, const QList<T>& c)
     {
+        Q_ASSERT_X(size_t(i) < size_t(columnCount()), Q_FUNC_INFO, "index out of range");
+
         // Expand height if c is larger than current height
-        qsizetype rows = rowCount();
-        qsizetype rowGrowth = rows - c.size();
-        if(rowGrowth > 0)
+        if(c.size() > rowCount())
             resizeRows(c.size());
 
-        // Replace with values from column, or default values if column is smaller than height
-        for(qsizetype r = 0; r < rows; r++)
-            mTable[r].replace(i, r > c.size() - 1 ? T() : c[r]);
+        assignFrom(columnView(i), c);
     }
 
     void replaceRow(qsizetype i, const QList<T>& r)
     {
+        Q_ASSERT_X(size_t(i) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
+
         // Expand width if r is larger than current width
-        qsizetype columns = columnCount();
-        qsizetype columnGrowth = columns - r.size();
-        if(columnGrowth > 0)
+        if(r.size() > columnCount())
             resizeColumns(r.size());
 
-        // Replace row, then expand it if it's smaller than the current width
-        mTable.replace(i, r);
-        if(columnGrowth < 0)
-            mTable[i].resize(columns);
+        assignFrom(rowView(i), r);
     }
 
     void reserve(QSize size)
     {
-        /* TODO: This class could be modified so that it somehow tracks which rows are
-         * actually part of the table, so that empty rows could be added without messing up the actual row
-         * count/size of the table. This would avoid the limitation mentioned in this methods doc, as empty
-         * rows could be added, which then have reserve called on them in order to reserve the full
-         * size specified by the user, though it would add a small amount of overhead elsewhere.
-         */
-
         if(size == Table::size())
             return;
 
-        mTable.reserve(size.height());
-        for(QList<T>& row : mTable)
-            row.reserve(size.width());
+        mTable.reserve(qsizetype(size.width()) * size.height());
     }
 
     void resize(QSize size)
@@ -345,8 +618,11 @@ public:
         if(size == Table::size())
             return;
 
-        resizeRows(size.height());
+        // Shrink first so that as little as possible is shifted
+        if(size.height() < mRows)
+            resizeRows(size.height());
         resizeColumns(size.width());
+        resizeRows(size.height());
     }
 
     void resizeColumns(qsizetype size)
@@ -354,8 +630,10 @@ public:
         if(size == columnCount())
             return;
 
-        for(QList<T>& row : mTable)
-            row.resize(size);
+        if(size > mColumns)
+            insertColumnSpace(mColumns, size - mColumns);
+        else
+            removeColumnSpace(size, mColumns - size);
     }
 
     void resizeRows(qsizetype size)
@@ -363,27 +641,34 @@ public:
         if(size == rowCount())
             return;
 
-        qsizetype currentSize = rowCount();
-        qsizetype growth = size - currentSize;
-        qsizetype columns = columnCount();
+        if(size > mRows)
+            insertRowSpace(mRows, size - mRows);
+        else
+            removeRowSpace(size, mRows - size);
+    }
 
-        mTable.resize(size);
+    void setLayout(Layout layout)
+    {
+        if(layout == mLayout)
+            return;
 
-        if(growth > 0 && columns > 0)
-        {
+        // The lines of the new layout are the cross-lines of the current one
+        qsizetype lines = mLayout == RowMajor ? mRows : mColumns;
+        qsizetype length = mLayout == RowMajor ? mColumns : mRows;
 
-            for(qsizetype r = currentSize; r < rowCount(); r++)
-                mTable[r].resize(columns);
-        }
-    }
+        QList<T> reordered;
+        reordered.reserve(mTable.size());
+        const T* data = mTable.constData();
+        for(qsizetype k = 0; k < length; k++)
+            for(qsizetype l = 0; l < lines; l++)
+                reordered.append(data[l * length + k]);
 
-    void squeeze()
-    {
-        mTable.squeeze();
-        for(QList<T>& row : mTable)
-            row.squeeze();
+        mTable.swap(reordered);
+        mLayout = layout;
     }
 
+    void squeeze() { mTable.squeeze(); }
+
     QList<T> takeColumnAt(qsizetype i)
     {
         Q_ASSERT_X(size_t(i) < size_t(columnCount()), Q_FUNC_INFO, "index out of range");
@@ -407,29 +692,48 @@ public:
 
     QList<T> takeLastColumn()
     {
-        qsizetype height = columnCount();
-        Q_ASSERT(height > 0);
-        return takeColumnAt(height - 1);
+        qsizetype width = columnCount();
+        Q_ASSERT(width > 0);
+        return takeColumnAt(width - 1);
     }
 
     QList<T> takeLastRow()
     {
-        qsizetype width = rowCount();
-        Q_ASSERT(width > 0);
-        return takeRowAt(width - 1);
+        qsizetype height = rowCount();
+        Q_ASSERT(height > 0);
+        return takeRowAt(height - 1);
     }
 
     QList<T> takeRowAt(qsizetype i)
     {
         Q_ASSERT_X(size_t(i) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
 
-        return mTable.takeAt(i);
+        QList<T> row = rowAt(i);
+        removeRowAt(i);
+        return row;
     }
 
     qsizetype width() const { return columnCount(); }
 
-    bool operator==(const Table& other) const { return mTable == other.mTable; }
-    bool operator!=(const Table& other) const { return !(mTable == other.mTable); }
+    bool operator==(const Table& other) const
+    {
+        if(size() != other.size())
+            return false;
+
+        if(mLayout == other.mLayout)
+            return mTable == other.mTable;
+
+        for(qsizetype r = 0; r < mRows; r++)
+        {
+            const_view a = rowView(r), b = other.rowView(r);
+            if(!std::equal(a.begin(), a.end(), b.begin()))
+                return false;
+        }
+
+        return true;
+    }
+
+    bool operator!=(const Table& other) const { return !(*this == other); }
 };
 
 }
@@ -0,0 +1,100 @@
+// Unit Includes
+#include "qx-dsvtokenizer.h"
+
+// Standard Library Includes
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define QX_DSV_SSE2
+    #include <emmintrin.h>
+#endif
+
+/*! @cond */
+namespace Qx
+{
+
+//===============================================================================================================
+// DsvTokenizer::StructuralScanner
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+DsvTokenizer::StructuralScanner::StructuralScanner(QByteArrayView data, char delim, char esc) :
+    mData(data.data()),
+    mSize(data.size()),
+    mBlock(0),
+    mMask(blockMask(mData, std::min(BLOCK_SIZE, mSize), delim, esc)),
+    mDelim(delim),
+    mEsc(esc)
+{}
+
+//-Class Functions----------------------------------------------------------------------------------------------
+//Public:
+quint64 DsvTokenizer::StructuralScanner::blockMask(const char* block, qsizetype size, char delim, char esc)
+{
+    // Bit i is set if block[i] is a special character
+    Q_ASSERT(size <= BLOCK_SIZE);
+    quint64 mask = 0;
+    qsizetype i = 0;
+
+#ifdef QX_DSV_SSE2
+    const __m128i d = _mm_set1_epi8(delim);
+    const __m128i e = _mm_set1_epi8(esc);
+    const __m128i n = _mm_set1_epi8('\n');
+    const __m128i r = _mm_set1_epi8('\r');
+    for(; i + 16 <= size; i += 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, d), _mm_cmpeq_epi8(chars, e)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(chars, n), _mm_cmpeq_epi8(chars, r)));
+        mask |= static_cast<quint64>(static_cast<quint32>(_mm_movemask_epi8(hits))) << i;
+    }
+#endif
+
+    for(; i < size; i++)
+    {
+        char c = block[i];
+        if(c == delim || c == esc || c == '\n' || c == '\r')
+            mask |= quint64(1) << i;
+    }
+
+    return mask;
+}
+
+//===============================================================================================================
+// DsvTokenizer
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+DsvTokenizer::DsvTokenizer(QChar delim, QChar esc, qsizetype offset) :
+    mDelim(delim.toLatin1()),
+    mEsc(esc.toLatin1()),
+    mOffset(offset),
+    mEscapedField(false),
+    mPostEscape(false),
+    mColumnCount(-1),
+    mRowCount(0),
+    mRowFields(0)
+{
+    Q_ASSERT(canTokenize(delim, esc));
+}
+
+//-Class Functions----------------------------------------------------------------------------------------------
+//Private:
+const char* DsvTokenizer::utf8CharEnd(const char* c, const char* end)
+{
+    // Malformed sequences are treated as single bytes, each of which decodes to a replacement character
+    uchar lead = static_cast<uchar>(*c);
+    qsizetype len = lead < 0xC0 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF8 ? 4 : 1;
+    return std::min(c + len, end);
+}
+
+//Public:
+bool DsvTokenizer::canTokenize(QChar delim, QChar esc)
+{
+    // Special characters must be ASCII so that they can't be part of a multi-byte sequence
+    auto usable = [](QChar c){ return c.unicode() < 0x80 && c != u'\n' && c != u'\r'; };
+    return usable(delim) && usable(esc);
+}
+
+}
+/*! @endcond */
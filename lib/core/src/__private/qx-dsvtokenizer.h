@@ -0,0 +1,304 @@
+#ifndef QX_DSVTOKENIZER_H
+#define QX_DSVTOKENIZER_H
+
+// Standard Library Includes
+#include <bit>
+
+// Qt Includes
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QString>
+
+// Intra-component Includes
+#include "qx/core/qx-dsvtable.h"
+
+/*! @cond */
+namespace Qx
+{
+
+class DsvTokenizer
+{
+    /* Tokenizes UTF-8 encoded DSV data directly from its bytes. Rather than inspecting every character, the
+     * positions of the only bytes that can affect parsing (the delimiter, escape, '\n' and '\r') are located a
+     * block at a time as a bitmask, and everything in between is treated as a run of plain field content that is
+     * sliced out of the input in one go. Since those special characters are required to be ASCII, they can never
+     * appear inside a multi-byte UTF-8 sequence, so working on bytes is safe.
+     *
+     * The state machine applied at each special character deliberately mirrors the character-by-character one
+     * that DsvTable has always used (including '\r' being dropped like it is by a QIODevice in Text mode), so that
+     * the same input produces the same table and the same errors, at the same byte offsets.
+     *
+     * Input can be provided all at once or over several calls to feed(), with fields and rows being reported to a
+     * sink as they are completed. The sink must provide:
+     *
+     *   bool field(QByteArrayView value, qsizetype end);
+     *   void rowEnd();
+     *
+     * where 'value' is the unescaped, UTF-8 encoded content of the field (only valid for the duration of the call),
+     * and 'end' is the offset just past the character that ended it. If field() returns false, tokenizing stops
+     * right away as if an error occurred, though error() is left as is since the sink is what rejected the data.
+     */
+//-Class Variables-------------------------------------------------------------------------------------------------
+private:
+    static constexpr qsizetype BLOCK_SIZE = 64;
+
+//-Inner Classes----------------------------------------------------------------------------------------------------
+private:
+    class FieldBuilder
+    {
+        /* Most fields are a single, uninterrupted slice of the input, so this tracks the slice and only falls back
+         * to copying into a buffer when a field is interrupted (i.e. by an escaped escape character or a '\r') or
+         * when its slice must outlive the input it points to.
+         */
+    private:
+        const char* mBegin = nullptr;
+        const char* mEnd = nullptr;
+        QByteArray mSpill;
+        bool mSpilled = false;
+
+    public:
+        bool isEmpty() const { return mSpilled ? mSpill.isEmpty() : mBegin == mEnd; }
+
+        void append(const char* begin, const char* end)
+        {
+            if(!mSpilled)
+            {
+                if(mBegin == mEnd)
+                {
+                    mBegin = begin;
+                    mEnd = end;
+                    return;
+                }
+                else if(begin == mEnd)
+                {
+                    mEnd = end;
+                    return;
+                }
+
+                detach();
+            }
+
+            mSpill.append(begin, end - begin);
+        }
+
+        void detach()
+        {
+            if(!mSpilled)
+            {
+                mSpill.append(mBegin, mEnd - mBegin);
+                mSpilled = true;
+            }
+            mBegin = mEnd = nullptr;
+        }
+
+        QByteArrayView view() const { return mSpilled ? QByteArrayView(mSpill) : QByteArrayView(mBegin, mEnd - mBegin); }
+
+        void clear()
+        {
+            mBegin = mEnd = nullptr;
+            mSpill.truncate(0); // Keeps capacity
+            mSpilled = false;
+        }
+    };
+
+    class StructuralScanner
+    {
+    private:
+        const char* mData;
+        qsizetype mSize;
+        qsizetype mBlock;
+        quint64 mMask;
+        char mDelim;
+        char mEsc;
+
+    public:
+        StructuralScanner(QByteArrayView data, char delim, char esc);
+
+        static quint64 blockMask(const char* block, qsizetype size, char delim, char esc);
+
+        const char* next()
+        {
+            // Returns the next special character, or the end of the data
+            while(!mMask)
+            {
+                mBlock += BLOCK_SIZE;
+                if(mBlock >= mSize)
+                    return mData + mSize;
+                mMask = blockMask(mData + mBlock, std::min(BLOCK_SIZE, mSize - mBlock), mDelim, mEsc);
+            }
+
+            qsizetype bit = std::countr_zero(mMask);
+            mMask &= mMask - 1;
+            return mData + mBlock + bit;
+        }
+    };
+
+//-Instance Variables-------------------------------------------------------------------------------------------
+private:
+    char mDelim;
+    char mEsc;
+    qsizetype mOffset;
+    FieldBuilder mField;
+    bool mEscapedField;
+    bool mPostEscape;
+    qsizetype mColumnCount;
+    qsizetype mRowCount;
+    qsizetype mRowFields;
+    DsvParseError mError;
+
+//-Constructor--------------------------------------------------------------------------------------------------
+public:
+    DsvTokenizer(QChar delim, QChar esc, qsizetype offset = 0);
+
+//-Class Functions----------------------------------------------------------------------------------------------
+private:
+    static const char* utf8CharEnd(const char* c, const char* end);
+
+public:
+    static bool canTokenize(QChar delim, QChar esc);
+
+//-Instance Functions-------------------------------------------------------------------------------------------
+private:
+    bool fail(DsvParseError::ParseError error, qsizetype offset)
+    {
+        mError = DsvParseError(error, offset);
+        return false;
+    }
+
+    template<typename Sink>
+    bool endField(Sink& sink, bool rowEnd, qsizetype pos)
+    {
+        if(!sink.field(mField.view(), pos))
+            return false;
+        mField.clear();
+        mRowFields++;
+
+        // Ensure row isn't too long
+        if(mColumnCount != -1 && mRowFields > mColumnCount)
+            return fail(DsvParseError::UnevenColumns, pos);
+
+        if(rowEnd)
+        {
+            // If first row, set column count, otherwise, ensure row isn't too short
+            if(mColumnCount == -1)
+                mColumnCount = mRowFields;
+            else if(mRowFields < mColumnCount)
+                return fail(DsvParseError::UnevenColumns, pos);
+
+            sink.rowEnd();
+            mRowCount++;
+            mRowFields = 0;
+        }
+
+        return true;
+    }
+
+    template<typename Sink>
+    bool finish(Sink& sink)
+    {
+        if(mEscapedField && !mPostEscape) // Unterminated escaped field
+            return fail(DsvParseError::UnterminatedField, mOffset);
+        else if(mEscapedField || mRowFields > 0 || !mField.isEmpty()) // Data ended in the middle of a row
+        {
+            if(!sink.field(mField.view(), mOffset))
+                return false;
+            mField.clear();
+            mRowFields++;
+
+            // A short final row is accepted, and is padded out with empty fields
+            if(mColumnCount == -1)
+                mColumnCount = mRowFields;
+            else if(mRowFields > mColumnCount)
+                return fail(DsvParseError::UnevenColumns, mOffset);
+
+            for(; mRowFields < mColumnCount; mRowFields++)
+                sink.field(QByteArrayView(), mOffset);
+
+            sink.rowEnd();
+            mRowCount++;
+            mRowFields = 0;
+        }
+        // else <- Data ended with a trailing '\n', so there is no partial row
+
+        return true;
+    }
+
+public:
+    qsizetype columnCount() const { return mColumnCount; }
+    qsizetype rowCount() const { return mRowCount; }
+    qsizetype offset() const { return mOffset; }
+    bool atRowStart() const { return !mEscapedField && !mPostEscape && mField.isEmpty() && mRowFields == 0; }
+    DsvParseError error() const { return mError; }
+
+    template<typename Sink>
+    bool feed(QByteArrayView chunk, bool last, Sink& sink)
+    {
+        // Returns false if a parsing error occurred or the sink stopped parsing, after which the tokenizer must not be fed again
+        const char* const begin = chunk.data();
+        const char* const end = begin + chunk.size();
+        auto posAfter = [&](const char* c) { return mOffset + (c - begin) + 1; };
+
+        StructuralScanner scanner(chunk, mDelim, mEsc);
+        const char* p = begin;
+        for(const char* s = scanner.next(); ; s = scanner.next())
+        {
+            // Plain content up to the special character
+            if(p < s)
+            {
+                if(mPostEscape) // Illegal escape char use
+                    return fail(DsvParseError::IllegalEscape, posAfter(utf8CharEnd(p, end) - 1) - 1);
+
+                mField.append(p, s);
+            }
+
+            if(s == end)
+                break;
+
+            p = s + 1;
+            char ch = *s;
+
+            // Character check
+            if(ch == '\r')
+                continue;
+            else if(ch == mEsc)
+            {
+                if(mField.isEmpty()) // Start of field
+                    mEscapedField = true;
+                else if(mPostEscape) // Literal escape character
+                {
+                    mField.append(s, p);
+                    mPostEscape = false;
+                }
+                else if(!mEscapedField) // Illegal escape char use
+                    return fail(DsvParseError::IllegalEscape, posAfter(s));
+                else
+                    mPostEscape = true;
+            }
+            else if(!mEscapedField || mPostEscape) // Delimiter or newline that ends a field
+            {
+                mPostEscape = false;
+                mEscapedField = false;
+                if(!endField(sink, ch == '\n', posAfter(s)))
+                    return false;
+            }
+            else // Delimiter or newline within an escaped field
+                mField.append(s, p);
+        }
+
+        mOffset += chunk.size();
+
+        if(!last)
+        {
+            // The current field cannot keep pointing into this chunk
+            mField.detach();
+            return true;
+        }
+
+        return finish(sink);
+    }
+};
+
+}
+/*! @endcond */
+
+#endif // QX_DSVTOKENIZER_H
@@ -1,9 +1,362 @@
 // Unit Includes
 #include "qx/core/qx-dsvtable.h"
 
+// Standard Library Includes
+#include <charconv>
+#include <optional>
+#include <vector>
+
+// Qt Includes
+#include <QDeadlineTimer>
+#include <QSemaphore>
+#include <QStringConverter>
+#include <QTextStream>
+#include <QThreadPool>
+
+// Intra-component Includes
+#include "__private/qx-dsvtokenizer.h"
+
 namespace Qx
 {
 
+namespace  // Anonymous namespace for effectively private (to this cpp) functions
+{
+
+bool hasByteParsableEncoding(const QByteArray& dsv, qsizetype& bomSize)
+{
+    /* The byte parser only handles UTF-8, so leave anything that QTextStream would auto-detect
+     * as another encoding to it. A UTF-8 BOM is simply skipped, like QTextStream does.
+     */
+    std::optional<QStringConverter::Encoding> enc = QStringConverter::encodingForData(dsv);
+    if(!enc)
+    {
+        bomSize = 0;
+        return true;
+    }
+    else if(*enc == QStringConverter::Utf8)
+    {
+        bomSize = 3;
+        return true;
+    }
+    else
+        return false;
+}
+
+void appendEncoded(QByteArray& out, QStringEncoder& encoder, QStringView str)
+{
+    // Encodes directly into the end of the existing buffer, which avoids a temporary per string
+    qsizetype size = out.size();
+    out.resize(size + encoder.requiredSpace(str.size()));
+    char* end = encoder.appendToBuffer(out.data() + size, str);
+    out.truncate(end - out.constData());
+}
+
+void appendField(QByteArray& out, QStringEncoder& encoder, QStringView field, QChar delim, QChar esc)
+{
+    // Escape if necessary
+    if(!field.contains(delim) && !field.contains(esc) && !field.contains(u'\n'))
+    {
+        appendEncoded(out, encoder, field);
+        return;
+    }
+
+    QStringView escView(&esc, 1);
+    appendEncoded(out, encoder, escView);
+    qsizetype start = 0;
+    for(qsizetype i = field.indexOf(esc); i != -1; i = field.indexOf(esc, start))
+    {
+        // Double each escape character
+        appendEncoded(out, encoder, field.sliced(start, i + 1 - start));
+        appendEncoded(out, encoder, escView);
+        start = i + 1;
+    }
+    appendEncoded(out, encoder, field.sliced(start));
+    appendEncoded(out, encoder, escView);
+}
+
+bool parseInteger(QByteArrayView field, qint64& value)
+{
+    auto [end, ec] = std::from_chars(field.begin(), field.end(), value);
+    return ec == std::errc() && end == field.end() && !field.isEmpty();
+}
+
+bool parseReal(QByteArrayView field, double& value)
+{
+    auto [end, ec] = std::from_chars(field.begin(), field.end(), value);
+    return ec == std::errc() && end == field.end() && !field.isEmpty();
+}
+
+bool parseBoolean(QByteArrayView field, bool& value)
+{
+    if(field.compare("true", Qt::CaseInsensitive) == 0)
+        value = true;
+    else if(field.compare("false", Qt::CaseInsensitive) == 0)
+        value = false;
+    else
+        return false;
+
+    return true;
+}
+
+template<typename T, typename Parser>
+bool convertText(const QByteArray& text, const QList<qsizetype>& offsets, QList<T>& values, Parser parse)
+{
+    // Converts every field of a text column, or leaves 'values' empty if any can't be converted
+    qsizetype count = offsets.size() - 1;
+    values.resize(count);
+    T* data = values.data();
+    for(qsizetype i = 0; i < count; i++)
+    {
+        QByteArrayView field(text.constData() + offsets.at(i), offsets.at(i + 1) - offsets.at(i));
+        if(!parse(field, data[i]))
+        {
+            values.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+DsvParseError parseBytes(QList<QVariant>& cells, qsizetype& rows, qsizetype& columns,
+                         const QByteArray& dsv, qsizetype bomSize, QChar delim, QChar esc)
+{
+    struct Sink
+    {
+        QList<QVariant>& cells;
+        bool field(QByteArrayView value, qsizetype) { cells.append(QString::fromUtf8(value)); return true; }
+        void rowEnd() {}
+    } sink{cells};
+
+    DsvTokenizer tokenizer(delim, esc, bomSize);
+    if(!tokenizer.feed(QByteArrayView(dsv).sliced(bomSize), true, sink))
+        return tokenizer.error();
+
+    rows = tokenizer.rowCount();
+    columns = rows ? tokenizer.columnCount() : 0;
+
+    return DsvParseError();
+}
+
+DsvParseError parseBytesConcurrent(QList<QVariant>& cells, qsizetype& rows, qsizetype& columns,
+                                   const QByteArray& dsv, qsizetype bomSize, QChar delim, QChar esc, QThreadPool* pool)
+{
+    /* Each chunk (other than the first) is speculatively assumed to start right after its first line break, in
+     * the same state as the start of the data, and is parsed on its own in parallel with the others. The
+     * assumption is then checked in order: it held if the previous chunk's parse, which is known to be correct,
+     * ended at the start of a row (i.e. the line break wasn't inside an escaped field) and settled on the same
+     * column count. Otherwise the chunk is parsed again, continuing on from where the previous one actually
+     * left off. Since every accepted chunk is parsed in exactly the state a sequential parse would have been in,
+     * the result, including any error and its offset, is identical to that of a sequential parse.
+     */
+    static constexpr qsizetype MIN_CHUNK_SIZE = 1024 * 1024;
+
+    struct Sink
+    {
+        QList<QVariant> cells;
+        qsizetype rows = 0;
+        bool field(QByteArrayView value, qsizetype) { cells.append(QString::fromUtf8(value)); return true; }
+        void rowEnd() { rows++; }
+    };
+
+    struct Chunk
+    {
+        QByteArrayView data;
+        bool last = false;
+        std::optional<DsvTokenizer> tokenizer;
+        Sink sink;
+        bool parsed = false;
+    };
+
+    QByteArrayView data = QByteArrayView(dsv).sliced(bomSize);
+
+    // Split
+    qsizetype maxChunks = std::min(data.size() / MIN_CHUNK_SIZE, qsizetype(pool->maxThreadCount()));
+    QList<qsizetype> starts{0};
+    for(qsizetype i = 1; i < maxChunks; i++)
+    {
+        qsizetype lineBreak = data.indexOf('\n', std::max(i * (data.size() / maxChunks), starts.last()));
+        if(lineBreak == -1 || lineBreak + 1 == data.size())
+            break;
+        starts.append(lineBreak + 1);
+    }
+
+    if(starts.size() == 1)
+        return parseBytes(cells, rows, columns, dsv, bomSize, delim, esc);
+
+    std::vector<Chunk> chunks(starts.size());
+    for(size_t i = 0; i < chunks.size(); i++)
+    {
+        qsizetype end = i + 1 < chunks.size() ? starts.at(i + 1) : data.size();
+        chunks[i].data = data.sliced(starts.at(i), end - starts.at(i));
+        chunks[i].last = i + 1 == chunks.size();
+    }
+
+    auto parseChunk = [](Chunk& chunk, DsvTokenizer tokenizer) {
+        chunk.sink = Sink();
+        chunk.parsed = tokenizer.feed(chunk.data, chunk.last, chunk.sink);
+        chunk.tokenizer = std::move(tokenizer);
+    };
+
+    // Speculatively parse all chunks, doing any that the pool can't take right away on this thread
+    QSemaphore finished;
+    for(size_t i = 1; i < chunks.size(); i++)
+    {
+        qsizetype offset = bomSize + starts.at(i);
+        auto task = [&, i, offset]{
+            parseChunk(chunks[i], DsvTokenizer(delim, esc, offset));
+            finished.release();
+        };
+
+        if(!pool->tryStart(task))
+            task();
+    }
+    parseChunk(chunks[0], DsvTokenizer(delim, esc, bomSize));
+    finished.acquire(static_cast<int>(chunks.size() - 1));
+
+    // Validate speculation in order, re-parsing chunks that started in the wrong state
+    for(size_t i = 0; i < chunks.size(); i++)
+    {
+        const Chunk& chunk = chunks[i];
+        if(!chunk.parsed)
+            return chunk.tokenizer->error();
+
+        if(i + 1 < chunks.size())
+        {
+            Chunk& next = chunks[i + 1];
+            const DsvTokenizer& actual = *chunk.tokenizer;
+            if(!actual.atRowStart() || actual.columnCount() == -1 || actual.columnCount() != next.tokenizer->columnCount())
+                parseChunk(next, actual);
+        }
+    }
+
+    // Stitch
+    qsizetype cellCount = 0;
+    for(const Chunk& chunk : chunks)
+        cellCount += chunk.sink.cells.size();
+
+    cells.reserve(cellCount);
+    rows = 0;
+    for(Chunk& chunk : chunks)
+    {
+        cells.append(std::move(chunk.sink.cells));
+        rows += chunk.sink.rows;
+    }
+    columns = rows ? chunks.back().tokenizer->columnCount() : 0;
+
+    return DsvParseError();
+}
+
+DsvParseError parseStream(QList<QVariant>& cells, qsizetype& rows, qsizetype& columns,
+                          const QByteArray& dsv, QChar delim, QChar esc)
+{
+    /* Character-by-character parser, used when the data isn't UTF-8 or the special characters
+     * aren't all ASCII
+     */
+
+    // Setup
+    QTextStream parser(dsv, QIODeviceBase::OpenMode(QIODeviceBase::ReadOnly | QIODeviceBase::Text));
+
+    // Working var
+    qsizetype columnCount = -1;
+    qsizetype rowCount = 0;
+    qsizetype rowFields = 0;
+    QString currentField;
+    bool escapedField = false;
+    bool postEscape = false;
+
+    // Parse
+    while(!parser.atEnd())
+    {
+        // Get next character
+        QChar ch;
+        parser >> ch;
+
+        // Character check
+        if(ch == esc)
+        {
+            if(currentField.isEmpty()) // Start of field
+                escapedField = true;
+            else if(postEscape) // Literal escape character
+            {
+                currentField.append(esc);
+                postEscape = false;
+            }
+            else if(!escapedField) // Illegal escape char use
+                return DsvParseError(DsvParseError::IllegalEscape, parser.pos());
+            else
+                postEscape = true;
+        }
+        else if((ch == delim || ch == '\n') && (!escapedField || postEscape))
+        {
+            // Handle field end
+            postEscape = false;
+            escapedField = false;
+            cells.append(currentField);
+            currentField.clear();
+            rowFields++;
+
+            // Ensure row isn't too long
+            if(columnCount != -1 && rowFields > columnCount)
+                return DsvParseError(DsvParseError::UnevenColumns, parser.pos());
+
+            // Handle row end
+            if(ch == '\n')
+            {
+                // If first row, set column count, otherwise, ensure row isn't too short
+                if(columnCount == -1)
+                    columnCount = rowFields;
+                else if(rowFields < columnCount)
+                    return DsvParseError(DsvParseError::UnevenColumns, parser.pos());
+
+                // Start next row
+                rowCount++;
+                rowFields = 0;
+            }
+        }
+        else
+        {
+            if(postEscape) // Illegal escape char use
+                return DsvParseError(DsvParseError::IllegalEscape, parser.pos() - 1);
+            else
+                currentField.append(ch);
+        }
+    }
+
+    // Check for stream error
+    if(parser.status() != QTextStream::Ok)
+        return DsvParseError(DsvParseError::InternalError, parser.pos());
+
+    // Handle end of file
+    if(escapedField && !postEscape) // Unterminated escaped field
+        return DsvParseError(DsvParseError::UnterminatedField, parser.pos());
+    else if(escapedField || rowFields > 0 || !currentField.isEmpty()) // Data ended in the middle of a row
+    {
+        // Handle final field value
+        cells.append(currentField);
+        rowFields++;
+
+        // A short final row is accepted, and since rows are stored contiguously, is padded out with empty fields
+        if(columnCount == -1)
+            columnCount = rowFields;
+        else if(rowFields > columnCount)
+            return DsvParseError(DsvParseError::UnevenColumns, parser.pos());
+
+        for(; rowFields < columnCount; rowFields++)
+            cells.append(QString());
+
+        rowCount++;
+    }
+    // else <- Data ended with a trailing '\n', so there is no partial row
+
+    rows = rowCount;
+    columns = rowCount ? columnCount : 0;
+
+    return DsvParseError();
+}
+
+}
+
 //===============================================================================================================
 // DsvParseError
 //===============================================================================================================
@@ -50,6 +403,11 @@ namespace Qx
  *  An internal parser error occurred.
  */
 
+/*!
+ *  @var DsvParseError::ParseError DsvParseError::TypeMismatch
+ *  A field could not be converted to the type of its column.
+ */
+
 //-Constructor--------------------------------------------------------------------------------------------------
 //Public:
 /*!
@@ -147,6 +505,10 @@ DsvTable::DsvTable(std::initializer_list<std::initializer_list<QVariant>> table)
  *  Parses @a dsv as a delimiter-separated values table, using @a delim as the delimiter and
  *  @a esc as the quote/escape character, and creates a DsvTable from it.
  *
+ *  The final row does not need to be followed by a line break, and if it has fewer fields than the
+ *  first row it is padded out with empty fields. If that row's last field is quoted, the field is
+ *  kept as well, whereas earlier versions dropped it.
+ *
  *  If parsing fails, the returned table will be empty and the optional @a error variable will
  *  contain further details about the error.
  *
@@ -164,107 +526,53 @@ DsvTable DsvTable::fromDsv(const QByteArray& dsv, QChar delim, QChar esc, DsvPar
     if(dsv.isEmpty())
         return DsvTable();
 
-    // Setup
+    // Parse, preferring to work directly on the bytes when possible
     DsvTable table;
-    table.mTable.append(QList<QVariant>()); // Add first empty row
-    QTextStream parser(dsv, QIODeviceBase::OpenMode(QIODeviceBase::ReadOnly | QIODeviceBase::Text));
-
-    // Working var
-    qsizetype columnCount = -1;
-    QString currentField;
-    bool escapedField = false;
-    bool postEscape = false;
+    DsvParseError parseError;
+    qsizetype bomSize = 0;
+    if(DsvTokenizer::canTokenize(delim, esc) && hasByteParsableEncoding(dsv, bomSize))
+        parseError = parseBytes(table.mTable, table.mRows, table.mColumns, dsv, bomSize, delim, esc);
+    else
+        parseError = parseStream(table.mTable, table.mRows, table.mColumns, dsv, delim, esc);
 
-    // Parse
-    while(!parser.atEnd())
+    if(parseError.error() != DsvParseError::NoError)
     {
-        // Get next character
-        QChar ch;
-        parser >> ch;
-
-        // Character check
-        if(ch == esc)
-        {
-            if(currentField.isEmpty()) // Start of field
-                escapedField = true;
-            else if(postEscape) // Literal escape character
-            {
-                currentField.append(esc);
-                postEscape = false;
-            }
-            else if(!escapedField) // Illegal escape char use
-            {
-                setError(DsvParseError(DsvParseError::IllegalEscape, parser.pos()));
-                return DsvTable();
-            }
-            else
-                postEscape = true;
-        }
-        else if((ch == delim || ch == '\n') && (!escapedField || postEscape))
-        {
-            // Handle field end
-            postEscape = false;
-            escapedField = false;
-            table.mTable.back().append(currentField);
-            currentField.clear();
-
-            // Ensure row isn't too long
-            if(columnCount != -1 && table.mTable.back().size() > columnCount)
-            {
-                setError(DsvParseError(DsvParseError::UnevenColumns, parser.pos()));
-                return DsvTable();
-            }
+        setError(parseError);
+        return DsvTable();
+    }
 
-            // Handle row end
-            if(ch == '\n')
-            {
-                // If first row, set column count, otherwise, ensure row isn't too short
-                if(columnCount == -1)
-                    columnCount = table.mTable.back().size();
-                else if(table.mTable.back().size() < columnCount)
-                {
-                    setError(DsvParseError(DsvParseError::UnevenColumns, parser.pos()));
-                    return DsvTable();
-                }
+    return table;
+}
 
-                // Add next row
-                table.mTable.append(QList<QVariant>());
-            }
-        }
-        else
-        {
-            if(postEscape) // Illegal escape char use
-            {
-                setError(DsvParseError(DsvParseError::IllegalEscape, parser.pos() - 1));
-                return DsvTable();
-            }
-            else
-                currentField.append(ch);
-        }
-    }
+/*!
+ *  Same as fromDsv(), except that large inputs are split into chunks that are parsed in parallel using
+ *  @a pool, or QThreadPool::globalInstance() if @a pool is @c nullptr.
+ *
+ *  The result, including any error and its offset, is always the same as that of fromDsv(). Inputs that are
+ *  too small to benefit, are not UTF-8, or use a non-ASCII delimiter or escape character are parsed on the
+ *  calling thread.
+ *
+ *  This function blocks until parsing is complete. If the pool has no thread available for a chunk, the
+ *  chunk is parsed on the calling thread instead, so it is safe to call this from within the pool itself.
+ *
+ *  @sa fromDsv().
+ */
+DsvTable DsvTable::fromDsvConcurrent(const QByteArray& dsv, QChar delim, QChar esc, DsvParseError* error, QThreadPool* pool)
+{
+    qsizetype bomSize = 0;
+    if(!DsvTokenizer::canTokenize(delim, esc) || !hasByteParsableEncoding(dsv, bomSize))
+        return fromDsv(dsv, delim, esc, error);
 
-    // Check for stream error
-    if(parser.status() != QTextStream::Ok)
-    {
-        setError(DsvParseError(DsvParseError::InternalError, parser.pos()));
-        return DsvTable();
-    }
+    // Utility
+    auto setError = [error](const DsvParseError& err) { if(error) *error = err; };
 
-    // Handle end of file
-    if(escapedField && !postEscape) // Unterminated escaped field
-    {
-        setError(DsvParseError(DsvParseError::UnterminatedField, parser.pos()));
+    // Parse
+    DsvTable table;
+    DsvParseError parseError = parseBytesConcurrent(table.mTable, table.mRows, table.mColumns, dsv, bomSize, delim, esc,
+                                                    pool ? pool : QThreadPool::globalInstance());
+    setError(parseError);
+    if(parseError.error() != DsvParseError::NoError)
         return DsvTable();
-    }
-    else if(!escapedField)
-    {
-        // If last row is empty (due to trailing '\n'), remove it
-        if(table.mTable.back().isEmpty()) // Data ended with a trailing '\n'
-            table.mTable.removeLast();
-        else // Handle field value // Data ended in middle of unescaped field
-            table.mTable.back().append(currentField);
-    }
-    // else <- An escaped field that ended with a quote, followed by EOF needs to extra handling
 
     return table;
 }
@@ -278,42 +586,811 @@ DsvTable DsvTable::fromDsv(const QByteArray& dsv, QChar delim, QChar esc, DsvPar
 QByteArray DsvTable::toDsv(QChar delim, QChar esc)
 {
     // Empty shortcut
-    if(mTable.isEmpty())
+    if(isEmpty())
         return QByteArray();
 
     // Setup
     QByteArray dsv;
-    QTextStream serializer(dsv);
+    QStringEncoder encoder(QStringEncoder::Utf8);
+    QStringView delimView(&delim, 1);
 
     // Print all values
-    for(const QList<QVariant>& row : mTable)
+    for(auto rItr = rowBegin(); rItr != rowEnd(); rItr++)
     {
-        for(auto itr = row.constBegin(); itr != row.constEnd(); itr++)
+        const_view row = *rItr;
+        for(auto itr = row.begin(); itr != row.end(); itr++)
         {
-            // Raw string data
-            QString fieldStr = (*itr).toString();
-
-            // Escape if necessary
-            if(fieldStr.contains(delim) || fieldStr.contains(esc))
-            {
-                fieldStr.replace(esc, QString(2, esc));
-                fieldStr.prepend(esc);
-                fieldStr.append(esc);
-            }
+            // Delimit
+            if(itr != row.begin())
+                appendEncoded(dsv, encoder, delimView);
 
             // Print
-            serializer << fieldStr;
-
-            // Delimit
-            if(itr != row.constEnd() - 1)
-                serializer << delim;
+            appendField(dsv, encoder, (*itr).toString(), delim, esc);
         }
 
         // Terminate line
-        serializer << '\n';
+        dsv.append('\n');
     }
 
     return dsv;
 }
 
+//===============================================================================================================
+// TypedDsvTable::Builder
+//===============================================================================================================
+
+/*! @cond */
+class TypedDsvTable::Builder
+{
+    // Tokenizer sink that converts each field into its column's storage as it is parsed
+//-Instance Variables------------------------------------------------------------------------------------------------------------
+private:
+    TypedDsvTable& mTable;
+    const QList<ColumnType>& mSchema;
+    bool mHeaderPending;
+    bool mFirstRow;
+    qsizetype mColumn;
+    DsvParseError mError;
+
+//-Constructor-------------------------------------------------------------------------------------------------
+public:
+    Builder(TypedDsvTable& table, const QList<ColumnType>& schema, bool hasHeader) :
+        mTable(table),
+        mSchema(schema),
+        mHeaderPending(hasHeader),
+        mFirstRow(true),
+        mColumn(0)
+    {}
+
+//-Instance Functions---------------------------------------------------------------------------------------------------------
+public:
+    DsvParseError error() const { return mError; }
+
+    bool field(QByteArrayView value, qsizetype end)
+    {
+        // Stops the tokenizer at the first field that can't be converted
+        qsizetype c = mColumn++;
+
+        // The first row determines the columns
+        if(mFirstRow)
+        {
+            Column col;
+            col.type = mSchema.value(c, Auto);
+            if(col.type == Auto || col.type == String)
+                col.textOffsets.append(0);
+            mTable.mColumns.append(col);
+        }
+
+        if(mHeaderPending)
+        {
+            mTable.mHeaders.append(QString::fromUtf8(value));
+            return true;
+        }
+
+        // Fields past the end of a row are reported by the tokenizer
+        if(c >= mTable.mColumns.size())
+            return true;
+
+        Column& col = mTable.mColumns[c];
+        bool converted = true;
+        switch(col.type)
+        {
+            case Auto:
+            case String:
+                col.text.append(value);
+                col.textOffsets.append(col.text.size());
+                break;
+
+            case Integer:
+                converted = parseInteger(value, col.integers.emplace_back());
+                break;
+
+            case Real:
+                converted = parseReal(value, col.reals.emplace_back());
+                break;
+
+            case Boolean:
+                converted = parseBoolean(value, col.booleans.emplace_back());
+                break;
+        }
+
+        if(!converted)
+        {
+            mError = DsvParseError(DsvParseError::TypeMismatch, end);
+            return false;
+        }
+
+        return true;
+    }
+
+    void rowEnd()
+    {
+        if(mHeaderPending)
+            mHeaderPending = false;
+        else
+            mTable.mRows++;
+
+        mFirstRow = false;
+        mColumn = 0;
+    }
+
+    void finish()
+    {
+        // Settle the type of columns that were left to inference, favoring the most specific type that fits
+        for(Column& col : mTable.mColumns)
+        {
+            if(col.type == Auto)
+            {
+                if(mTable.mRows == 0)
+                    col.type = String;
+                else if(convertText(col.text, col.textOffsets, col.integers, parseInteger))
+                    col.type = Integer;
+                else if(convertText(col.text, col.textOffsets, col.reals, parseReal))
+                    col.type = Real;
+                else if(convertText(col.text, col.textOffsets, col.booleans, parseBoolean))
+                    col.type = Boolean;
+                else
+                    col.type = String;
+
+                if(col.type != String)
+                {
+                    col.text.clear();
+                    col.textOffsets.clear();
+                }
+            }
+
+            // Shed growth slack since the table is immutable from here on
+            col.integers.squeeze();
+            col.reals.squeeze();
+            col.booleans.squeeze();
+            col.text.squeeze();
+            col.textOffsets.squeeze();
+        }
+    }
+};
+/*! @endcond */
+
+//===============================================================================================================
+// TypedDsvTable
+//===============================================================================================================
+
+/*!
+ *  @class TypedDsvTable qx/core/qx-dsvtable.h
+ *  @ingroup qx-core
+ *
+ *  @brief The TypedDsvTable class provides a compact, read-only, columnar representation of
+ *  delimiter-separated values.
+ *
+ *  Where DsvTable stores every field as an individually allocated QVariant, TypedDsvTable stores each
+ *  column as a single contiguous array of a concrete type: 64-bit integers, doubles, booleans, or UTF-8
+ *  text that is packed into one buffer per column and addressed by offset. This makes the table far smaller
+ *  in memory, and allows whole columns to be processed efficiently via integerColumn(), realColumn() and
+ *  booleanColumn().
+ *
+ *  The type of each column is either provided up front via a schema, or inferred from the data once it
+ *  has been parsed, in which case the most specific type that can hold every field in the column is chosen
+ *  (Integer, then Real, then Boolean, and finally String).
+ *
+ *  Parsing follows the same rules as DsvTable::fromDsv(), and the delimiter and escape characters must
+ *  be ASCII.
+ *
+ *  @sa DsvTable.
+ */
+
+//-Class Enums-----------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  @enum TypedDsvTable::ColumnType
+ *
+ *  This enum describes how the fields of a column are stored.
+ */
+
+/*!
+ *  @var TypedDsvTable::ColumnType TypedDsvTable::Auto
+ *  The type of the column is inferred from its fields. This is only used in schemas, as the type of a
+ *  parsed column is always one of the other values.
+ */
+
+/*!
+ *  @var TypedDsvTable::ColumnType TypedDsvTable::String
+ *  Fields are stored as UTF-8 text.
+ */
+
+/*!
+ *  @var TypedDsvTable::ColumnType TypedDsvTable::Integer
+ *  Fields are stored as 64-bit signed integers.
+ */
+
+/*!
+ *  @var TypedDsvTable::ColumnType TypedDsvTable::Real
+ *  Fields are stored as double precision floating point numbers.
+ */
+
+/*!
+ *  @var TypedDsvTable::ColumnType TypedDsvTable::Boolean
+ *  Fields are stored as booleans, and must be either @c true or @c false (case-insensitive).
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs an empty TypedDsvTable.
+ */
+TypedDsvTable::TypedDsvTable() :
+    mRows(0)
+{}
+
+//-Class Functions----------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Parses @a dsv as a delimiter-separated values table, using @a delim as the delimiter and
+ *  @a esc as the quote/escape character, and creates a TypedDsvTable from it. The type of every
+ *  column is inferred.
+ *
+ *  If parsing fails, the returned table will be empty and the optional @a error variable will
+ *  contain further details about the error.
+ */
+TypedDsvTable TypedDsvTable::fromDsv(const QByteArray& dsv, QChar delim, QChar esc, DsvParseError* error)
+{
+    return fromDsv(dsv, {}, false, delim, esc, error);
+}
+
+/*!
+ *  @overload
+ *
+ *  The type of each column is given by the corresponding entry in @a schema, with columns that have
+ *  no entry being treated as ColumnType::Auto. If a field cannot be converted to the type given for its
+ *  column, parsing fails with DsvParseError::TypeMismatch.
+ *
+ *  If @a hasHeader is @c true, the first row is treated as a header, which is made available via headers()
+ *  instead of being part of the table.
+ *
+ *  If @a dsv is not UTF-8, it is converted to UTF-8 before being parsed, and any error offset is relative
+ *  to the converted data.
+ */
+TypedDsvTable TypedDsvTable::fromDsv(const QByteArray& dsv, const QList<ColumnType>& schema, bool hasHeader,
+                                     QChar delim, QChar esc, DsvParseError* error)
+{
+    Q_ASSERT_X(DsvTokenizer::canTokenize(delim, esc), Q_FUNC_INFO, "delimiter and escape must be ASCII");
+
+    // Utility
+    auto setError = [error](const DsvParseError& err) { if(error) *error = err; };
+
+    // Reset error status
+    setError(DsvParseError());
+
+    // Empty shortcut
+    if(dsv.isEmpty())
+        return TypedDsvTable();
+
+    // Ensure UTF-8
+    qsizetype bomSize = 0;
+    if(!hasByteParsableEncoding(dsv, bomSize))
+    {
+        QStringDecoder decoder(*QStringConverter::encodingForData(dsv));
+        QString decoded = decoder.decode(dsv);
+        return fromDsv(decoded.toUtf8(), schema, hasHeader, delim, esc, error);
+    }
+
+    // Parse
+    TypedDsvTable table;
+    Builder builder(table, schema, hasHeader);
+    DsvTokenizer tokenizer(delim, esc, bomSize);
+    bool parsed = tokenizer.feed(QByteArrayView(dsv).sliced(bomSize), true, builder);
+
+    // A conversion error is what stopped the tokenizer, if there was one
+    if(builder.error().error() != DsvParseError::NoError)
+    {
+        setError(builder.error());
+        return TypedDsvTable();
+    }
+    else if(!parsed)
+    {
+        setError(tokenizer.error());
+        return TypedDsvTable();
+    }
+
+    builder.finish();
+    return table;
+}
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the number of columns in the table.
+ */
+qsizetype TypedDsvTable::columnCount() const { return mColumns.size(); }
+
+/*!
+ *  Returns the type of column @a c.
+ *
+ *  @a c must be a valid column index in the table (i.e. 0 <= @a c < columnCount()).
+ */
+TypedDsvTable::ColumnType TypedDsvTable::columnType(qsizetype c) const
+{
+    Q_ASSERT_X(size_t(c) < size_t(columnCount()), Q_FUNC_INFO, "index out of range");
+    return mColumns.at(c).type;
+}
+
+/*!
+ *  Returns the fields of the header row, or an empty list if the table was parsed without a header.
+ */
+QStringList TypedDsvTable::headers() const { return mHeaders; }
+
+/*!
+ *  Returns @c true if the table has no fields; otherwise, returns @c false.
+ */
+bool TypedDsvTable::isEmpty() const { return mRows == 0 || mColumns.isEmpty(); }
+
+/*!
+ *  Returns the number of rows in the table, excluding the header.
+ */
+qsizetype TypedDsvTable::rowCount() const { return mRows; }
+
+/*!
+ *  Returns the column count (width), and row count (height) of the table as a QSize object.
+ */
+QSize TypedDsvTable::size() const { return QSize(columnCount(), rowCount()); }
+
+/*!
+ *  Returns the fields of column @a c, which must be of type ColumnType::Integer.
+ *
+ *  @sa integerAt().
+ */
+std::span<const qint64> TypedDsvTable::integerColumn(qsizetype c) const
+{
+    Q_ASSERT_X(columnType(c) == Integer, Q_FUNC_INFO, "column type mismatch");
+    const QList<qint64>& values = mColumns.at(c).integers;
+    return std::span<const qint64>(values.constData(), values.size());
+}
+
+/*!
+ *  Returns the fields of column @a c, which must be of type ColumnType::Real.
+ *
+ *  @sa realAt().
+ */
+std::span<const double> TypedDsvTable::realColumn(qsizetype c) const
+{
+    Q_ASSERT_X(columnType(c) == Real, Q_FUNC_INFO, "column type mismatch");
+    const QList<double>& values = mColumns.at(c).reals;
+    return std::span<const double>(values.constData(), values.size());
+}
+
+/*!
+ *  Returns the fields of column @a c, which must be of type ColumnType::Boolean.
+ *
+ *  @sa booleanAt().
+ */
+std::span<const bool> TypedDsvTable::booleanColumn(qsizetype c) const
+{
+    Q_ASSERT_X(columnType(c) == Boolean, Q_FUNC_INFO, "column type mismatch");
+    const QList<bool>& values = mColumns.at(c).booleans;
+    return std::span<const bool>(values.constData(), values.size());
+}
+
+/*!
+ *  Returns the field at row @a r and column @a c, which must be of type ColumnType::Integer.
+ */
+qint64 TypedDsvTable::integerAt(qsizetype r, qsizetype c) const
+{
+    Q_ASSERT_X(size_t(r) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
+    return integerColumn(c)[r];
+}
+
+/*!
+ *  Returns the field at row @a r and column @a c, which must be of type ColumnType::Real.
+ */
+double TypedDsvTable::realAt(qsizetype r, qsizetype c) const
+{
+    Q_ASSERT_X(size_t(r) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
+    return realColumn(c)[r];
+}
+
+/*!
+ *  Returns the field at row @a r and column @a c, which must be of type ColumnType::Boolean.
+ */
+bool TypedDsvTable::booleanAt(qsizetype r, qsizetype c) const
+{
+    Q_ASSERT_X(size_t(r) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
+    return booleanColumn(c)[r];
+}
+
+/*!
+ *  Returns a view of the field at row @a r and column @a c, which must be of type ColumnType::String.
+ *
+ *  The view refers directly to the table's storage and is valid for as long as the table is.
+ */
+QUtf8StringView TypedDsvTable::stringAt(qsizetype r, qsizetype c) const
+{
+    Q_ASSERT_X(columnType(c) == String, Q_FUNC_INFO, "column type mismatch");
+    Q_ASSERT_X(size_t(r) < size_t(rowCount()), Q_FUNC_INFO, "index out of range");
+
+    const Column& col = mColumns.at(c);
+    qsizetype start = col.textOffsets.at(r);
+    return QUtf8StringView(col.text.constData() + start, col.textOffsets.at(r + 1) - start);
+}
+
+/*!
+ *  Returns the field at row @a r and column @a c as a QVariant, regardless of the column's type.
+ *
+ *  @a r and @a c must point to a valid position within the table.
+ */
+QVariant TypedDsvTable::value(qsizetype r, qsizetype c) const
+{
+    switch(columnType(c))
+    {
+        case Integer:
+            return integerAt(r, c);
+        case Real:
+            return realAt(r, c);
+        case Boolean:
+            return booleanAt(r, c);
+        default:
+            return stringAt(r, c).toString();
+    }
+}
+
+/*!
+ *  Returns a DsvTable with the same content as this table, with each field holding a value of
+ *  its column's type.
+ *
+ *  The header, if any, is not included.
+ */
+DsvTable TypedDsvTable::toDsvTable() const
+{
+    DsvTable table(size());
+    for(qsizetype c = 0; c < columnCount(); c++)
+    {
+        DsvTable::view col = table.columnView(c);
+        for(qsizetype r = 0; r < rowCount(); r++)
+            col[r] = value(r, c);
+    }
+
+    return table;
+}
+
+//===============================================================================================================
+// DsvReader
+//===============================================================================================================
+
+/*!
+ *  @class DsvReader qx/core/qx-dsvtable.h
+ *  @ingroup qx-core
+ *
+ *  @brief The DsvReader class parses delimiter-separated values from a QIODevice one row at a time.
+ *
+ *  Unlike DsvTable::fromDsv(), which requires the entire input up front and produces the entire table,
+ *  DsvReader reads from its device in fixed size chunks and hands out each row as soon as it has been parsed,
+ *  so that data of any size can be processed with a constant amount of memory.
+ *
+ *  Parsing follows the same rules as DsvTable::fromDsv(), including the validation of escape characters and
+ *  of the number of fields in each row, and errors are reported via the same DsvParseError type, with their
+ *  offset being relative to the start of the device's data. Rows that precede an error are still returned.
+ *
+ *  The input must be UTF-8 encoded (a leading BOM is ignored), and the delimiter and escape characters must
+ *  be ASCII.
+ *
+ *  When the device is sequential (e.g. a socket or process), readRow() waits for more data to arrive for
+ *  at most readTimeout() milliseconds. If none arrives in that time, readRow() returns @c false without
+ *  the reader being atEnd(), and can simply be called again later to resume.
+ *
+ *  @snippet qx-dsvtable.cpp 0
+ *
+ *  @sa DsvWriter, and DsvTable.
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a reader that parses DSV data from @a device, using @a delim as the delimiter and
+ *  @a esc as the quote/escape character.
+ *
+ *  The device must already be open for reading and must outlive the reader.
+ */
+DsvReader::DsvReader(QIODevice* device, QChar delim, QChar esc) :
+    mDevice(device),
+    mDelim(delim),
+    mEsc(esc),
+    mNextRow(0),
+    mNextField(0),
+    mFinished(false),
+    mReadTimeout(30000)
+{
+    Q_ASSERT_X(DsvTokenizer::canTokenize(delim, esc), Q_FUNC_INFO, "delimiter and escape must be ASCII");
+}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the reader. The device is not closed.
+ */
+DsvReader::~DsvReader() = default;
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Private:
+bool DsvReader::fill()
+{
+    // Drop rows that have already been handed out, keeping the fields of any partial row
+    mFields.remove(0, mNextField);
+    mRowEnds.resize(0);
+    mNextRow = 0;
+    mNextField = 0;
+
+    mChunk.resize(CHUNK_SIZE);
+    qint64 read = mDevice->read(mChunk.data(), CHUNK_SIZE);
+    if(read < 0)
+    {
+        mError = DsvParseError(DsvParseError::InternalError, mTokenizer ? mTokenizer->offset() : 0);
+        mFinished = true;
+        return true;
+    }
+    else if(read == 0 && mDevice->isSequential())
+    {
+        /* waitForReadyRead() fails both when the device has no more data to give and when the wait times
+         * out, so a wait that lasted the full timeout is taken to mean that the device has merely stalled
+         */
+        QDeadlineTimer deadline(mReadTimeout);
+        if(mDevice->waitForReadyRead(mReadTimeout))
+            return true; // More data is on the way
+        else if(deadline.hasExpired())
+            return false;
+    }
+
+    QByteArrayView data(mChunk.constData(), read);
+
+    // Start, skipping a BOM if present
+    if(!mTokenizer)
+    {
+        qsizetype bomSize = data.startsWith("\xEF\xBB\xBF") ? 3 : 0;
+        data = data.sliced(bomSize);
+        mTokenizer = std::make_unique<DsvTokenizer>(mDelim, mEsc, bomSize);
+    }
+
+    struct Sink
+    {
+        DsvReader* reader;
+        bool field(QByteArrayView value, qsizetype) { reader->mFields.append(QString::fromUtf8(value)); return true; }
+        void rowEnd() { reader->mRowEnds.append(reader->mFields.size()); }
+    } sink{this};
+
+    bool last = read == 0;
+    if(!mTokenizer->feed(data, last, sink))
+    {
+        mError = mTokenizer->error();
+        mFinished = true;
+    }
+    else if(last)
+        mFinished = true;
+
+    return true;
+}
+
+//Public:
+/*!
+ *  Returns the device that the reader parses.
+ */
+QIODevice* DsvReader::device() const { return mDevice; }
+
+/*!
+ *  Returns the number of fields in each row, which is determined by the first row, or @c -1
+ *  if the first row has not been parsed yet.
+ */
+qsizetype DsvReader::columnCount() const { return mTokenizer ? mTokenizer->columnCount() : -1; }
+
+/*!
+ *  Returns the error that stopped parsing, if any.
+ *
+ *  @sa hasError().
+ */
+DsvParseError DsvReader::error() const { return mError; }
+
+/*!
+ *  Returns @c true if parsing was stopped by an error; otherwise, returns @c false.
+ *
+ *  @sa error().
+ */
+bool DsvReader::hasError() const { return mError.error() != DsvParseError::NoError; }
+
+/*!
+ *  Returns @c true if every row has been read, or parsing was stopped by an error; otherwise, returns
+ *  @c false.
+ *
+ *  @sa readRow().
+ */
+bool DsvReader::atEnd() const { return mFinished && mNextRow == mRowEnds.size(); }
+
+/*!
+ *  Returns how long, in milliseconds, readRow() waits for more data from a sequential device before
+ *  giving up. The default is 30000 milliseconds.
+ *
+ *  @sa setReadTimeout().
+ */
+int DsvReader::readTimeout() const { return mReadTimeout; }
+
+/*!
+ *  Sets how long readRow() waits for more data from a sequential device to @a msecs milliseconds. If
+ *  @a msecs is -1, readRow() waits indefinitely.
+ *
+ *  Since the end of a sequential device's data is only recognized when a wait for more fails before the
+ *  timeout elapses, with a timeout of 0 the reader never reaches the end of such a device on its own.
+ *
+ *  @sa readTimeout().
+ */
+void DsvReader::setReadTimeout(int msecs) { mReadTimeout = msecs; }
+
+/*!
+ *  Parses the next row and places its fields in @a row, replacing its previous contents.
+ *  Passing the same list on each call allows its storage to be reused.
+ *
+ *  Returns @c true if a row was read; otherwise, returns @c false, which indicates that the end of the
+ *  data was reached, that an error occurred, or that a sequential device didn't provide any more data
+ *  within readTimeout(), in which case atEnd() and hasError() both return @c false.
+ *
+ *  @sa atEnd(), and hasError().
+ */
+bool DsvReader::readRow(QStringList& row)
+{
+    while(mNextRow == mRowEnds.size())
+    {
+        if(mFinished || !fill())
+            return false;
+    }
+
+    qsizetype rowEnd = mRowEnds.at(mNextRow++);
+    row.resize(0);
+    row.reserve(rowEnd - mNextField);
+    for(; mNextField < rowEnd; mNextField++)
+        row.append(std::move(mFields[mNextField]));
+
+    return true;
+}
+
+//===============================================================================================================
+// DsvWriter
+//===============================================================================================================
+
+/*!
+ *  @class DsvWriter qx/core/qx-dsvtable.h
+ *  @ingroup qx-core
+ *
+ *  @brief The DsvWriter class serializes delimiter-separated values to a QIODevice one row at a time.
+ *
+ *  DsvWriter is the streaming counterpart to DsvTable::toDsv(). Rows are escaped in the same manner,
+ *  encoded as UTF-8 into an internal buffer that is reused between rows, and written to the device
+ *  whenever that buffer grows large enough, as well as when flush() is called or the writer is destroyed.
+ *
+ *  The first row that is written determines the number of fields that every following row must have,
+ *  so that the output can always be read back.
+ *
+ *  @sa DsvReader, and DsvTable.
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a writer that serializes DSV data to @a device, using @a delim as the delimiter and
+ *  @a esc as the quote/escape character.
+ *
+ *  The device must already be open for writing and must outlive the writer.
+ */
+DsvWriter::DsvWriter(QIODevice* device, QChar delim, QChar esc) :
+    mDevice(device),
+    mDelim(delim),
+    mEsc(esc),
+    mEncoder(QStringEncoder::Utf8),
+    mColumnCount(-1)
+{}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Flushes any buffered rows, then destroys the writer. The device is not closed.
+ */
+DsvWriter::~DsvWriter() { flush(); }
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Private:
+bool DsvWriter::beginRow(qsizetype size)
+{
+    // Reject rows that would produce uneven columns
+    if(size == 0 || (mColumnCount != -1 && size != mColumnCount))
+        return false;
+
+    mColumnCount = size;
+    return true;
+}
+
+void DsvWriter::writeField(QStringView field, bool first)
+{
+    if(!first)
+        appendEncoded(mBuffer, mEncoder, QStringView(&mDelim, 1));
+
+    appendField(mBuffer, mEncoder, field, mDelim, mEsc);
+}
+
+bool DsvWriter::endRow()
+{
+    mBuffer.append('\n');
+    return mBuffer.size() < FLUSH_THRESHOLD || flush();
+}
+
+//Public:
+/*!
+ *  Returns the device that the writer serializes to.
+ */
+QIODevice* DsvWriter::device() const { return mDevice; }
+
+/*!
+ *  Returns the number of fields that each row must have, which is determined by the first row
+ *  written, or @c -1 if no rows have been written yet.
+ */
+qsizetype DsvWriter::columnCount() const { return mColumnCount; }
+
+/*!
+ *  Writes @a row as the next row.
+ *
+ *  Returns @c true if the row was accepted; otherwise, returns @c false, which occurs if @a row
+ *  is empty, does not have the same number of fields as the previous rows, or if the row triggered
+ *  a flush that failed. A row that is rejected for its size is not written.
+ *
+ *  @sa flush().
+ */
+bool DsvWriter::writeRow(const QStringList& row)
+{
+    if(!beginRow(row.size()))
+        return false;
+
+    for(qsizetype i = 0; i < row.size(); i++)
+        writeField(row.at(i), i == 0);
+
+    return endRow();
+}
+
+/*!
+ *  @overload
+ *
+ *  Each field is converted to a string with QVariant::toString().
+ */
+bool DsvWriter::writeRow(const QList<QVariant>& row)
+{
+    if(!beginRow(row.size()))
+        return false;
+
+    for(qsizetype i = 0; i < row.size(); i++)
+        writeField(row.at(i).toString(), i == 0);
+
+    return endRow();
+}
+
+/*!
+ *  @overload
+ *
+ *  This allows rows to be written directly from a DsvTable via DsvTable::rowView().
+ */
+bool DsvWriter::writeRow(DsvTable::const_view row)
+{
+    if(!beginRow(row.size()))
+        return false;
+
+    for(qsizetype i = 0; i < row.size(); i++)
+        writeField(row.at(i).toString(), i == 0);
+
+    return endRow();
+}
+
+/*!
+ *  Writes all buffered rows to the device.
+ *
+ *  Returns @c true if the data was written successfully; otherwise, returns @c false.
+ */
+bool DsvWriter::flush()
+{
+    if(mBuffer.isEmpty())
+        return true;
+
+    bool written = mDevice->write(mBuffer) == mBuffer.size();
+    mBuffer.truncate(0); // Keeps capacity
+    return written;
+}
+
 }
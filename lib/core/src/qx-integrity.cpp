@@ -1,6 +1,246 @@
 // Unit Includes
 #include "qx/core/qx-integrity.h"
 
+// Standard Library Includes
+#include <array>
+
+// Qt Includes
+#include <QtEndian>
+#include <QIODevice>
+
+// Intrinsics
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define QX_CRC32_CLMUL
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define QX_CRC32_CLMUL_TARGET
+    #else
+        #define QX_CRC32_CLMUL_TARGET __attribute__((target("pclmul,sse4.1")))
+    #endif
+#endif
+
+namespace
+{
+// IMPLEMENTATION DETAILS FOR CRC32
+
+// LSB-first (reflected) ISO 3309/ITU-T V.42 polynomial
+constexpr quint32 LSB_POLYNOMIAL = 0xEDB88320;
+
+/* Slicing-by-16 tables. Table 0 is the classic byte-at-a-time table, while table k gives the effect of a byte
+ * that is followed by k more bytes, which allows 16 bytes to be processed at once with independent lookups.
+ */
+using SliceTables = std::array<std::array<quint32, 256>, 16>;
+
+constexpr SliceTables makeSliceTables()
+{
+    SliceTables tables{};
+
+    for(quint32 i = 0; i < 256; i++)
+    {
+        quint32 crc = i;
+        for(int bit = 0; bit < 8; bit++)
+            crc = crc & 1 ? (crc >> 1) ^ LSB_POLYNOMIAL : crc >> 1;
+        tables[0][i] = crc;
+    }
+
+    for(size_t s = 1; s < tables.size(); s++)
+        for(size_t i = 0; i < 256; i++)
+            tables[s][i] = (tables[s - 1][i] >> 8) ^ tables[0][tables[s - 1][i] & 0xFF];
+
+    return tables;
+}
+
+constexpr SliceTables SLICE_TABLES = makeSliceTables();
+
+quint32 updateSliced(quint32 crc, const uchar* data, qsizetype size)
+{
+    const auto& t = SLICE_TABLES;
+
+    // Slicing-by-16
+    for(; size >= 16; data += 16, size -= 16)
+    {
+        quint32 a = qFromLittleEndian<quint32>(data) ^ crc;
+        quint32 b = qFromLittleEndian<quint32>(data + 4);
+        quint32 c = qFromLittleEndian<quint32>(data + 8);
+        quint32 d = qFromLittleEndian<quint32>(data + 12);
+
+        crc = t[15][a & 0xFF] ^ t[14][(a >> 8) & 0xFF] ^ t[13][(a >> 16) & 0xFF] ^ t[12][a >> 24] ^
+              t[11][b & 0xFF] ^ t[10][(b >> 8) & 0xFF] ^ t[9][(b >> 16) & 0xFF] ^ t[8][b >> 24] ^
+              t[7][c & 0xFF] ^ t[6][(c >> 8) & 0xFF] ^ t[5][(c >> 16) & 0xFF] ^ t[4][c >> 24] ^
+              t[3][d & 0xFF] ^ t[2][(d >> 8) & 0xFF] ^ t[1][(d >> 16) & 0xFF] ^ t[0][d >> 24];
+    }
+
+    // Slicing-by-8
+    if(size >= 8)
+    {
+        quint32 a = qFromLittleEndian<quint32>(data) ^ crc;
+        quint32 b = qFromLittleEndian<quint32>(data + 4);
+
+        crc = t[7][a & 0xFF] ^ t[6][(a >> 8) & 0xFF] ^ t[5][(a >> 16) & 0xFF] ^ t[4][a >> 24] ^
+              t[3][b & 0xFF] ^ t[2][(b >> 8) & 0xFF] ^ t[1][(b >> 16) & 0xFF] ^ t[0][b >> 24];
+
+        data += 8;
+        size -= 8;
+    }
+
+    // Remainder
+    for(; size > 0; data++, size--)
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xFF];
+
+    return crc;
+}
+
+#ifdef QX_CRC32_CLMUL
+constexpr qsizetype CLMUL_MIN_SIZE = 64;
+
+bool hasClmul()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 1)) && (info[2] & (1 << 19)); // PCLMULQDQ and SSE4.1
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+QX_CRC32_CLMUL_TARGET inline __m128i fold(__m128i x, __m128i k, __m128i next)
+{
+    // Multiplies both halves of x by their respective constant in k and adds the next 128 bits
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), _mm_clmulepi64_si128(x, k, 0x00)), next);
+}
+
+QX_CRC32_CLMUL_TARGET quint32 updateClmul(quint32 crc, const uchar* data, qsizetype size)
+{
+    /* Folding with carry-less multiplication, as described in Intel's "Fast CRC Computation for Generic
+     * Polynomials Using PCLMULQDQ Instruction". Four 128-bit lanes are folded forward 512 bits at a time, then
+     * into a single lane, which is finally Barrett reduced down to 32 bits. The constants are the powers of x
+     * modulo the (bit-reflected) polynomial that the paper gives for CRC-32.
+     *
+     * 'size' must be a multiple of 16 and at least CLMUL_MIN_SIZE.
+     */
+    Q_ASSERT(size >= CLMUL_MIN_SIZE && size % 16 == 0);
+
+    const __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+    const __m128i k5k0 = _mm_set_epi64x(0, 0x0163CD6124);
+    const __m128i poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    auto load = [](const uchar* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); };
+
+    __m128i x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x2 = load(data + 16);
+    __m128i x3 = load(data + 32);
+    __m128i x4 = load(data + 48);
+    data += 64;
+    size -= 64;
+
+    // Fold by 4
+    for(; size >= 64; data += 64, size -= 64)
+    {
+        x1 = fold(x1, k1k2, load(data));
+        x2 = fold(x2, k1k2, load(data + 16));
+        x3 = fold(x3, k1k2, load(data + 32));
+        x4 = fold(x4, k1k2, load(data + 48));
+    }
+
+    // Fold lanes into one
+    x1 = fold(x1, k3k4, x2);
+    x1 = fold(x1, k3k4, x3);
+    x1 = fold(x1, k3k4, x4);
+
+    // Fold by 1
+    for(; size >= 16; data += 16, size -= 16)
+        x1 = fold(x1, k3k4, load(data));
+
+    // 128 to 64 bits
+    __m128i x2r = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2r);
+
+    // 64 to 32 bits
+    x2r = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2r);
+
+    // Barrett reduction
+    x2r = _mm_and_si128(x1, mask32);
+    x2r = _mm_clmulepi64_si128(x2r, poly, 0x10);
+    x2r = _mm_and_si128(x2r, mask32);
+    x2r = _mm_clmulepi64_si128(x2r, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2r);
+
+    return static_cast<quint32>(_mm_extract_epi32(x1, 1));
+}
+#endif
+
+quint32 updateRegister(quint32 crc, const uchar* data, qsizetype size)
+{
+#ifdef QX_CRC32_CLMUL
+    static const bool clmul = hasClmul();
+    if(clmul && size >= CLMUL_MIN_SIZE)
+    {
+        qsizetype bulk = size & ~qsizetype(15);
+        crc = updateClmul(crc, data, bulk);
+        data += bulk;
+        size -= bulk;
+    }
+#endif
+
+    return updateSliced(crc, data, size);
+}
+
+/* Combination works by multiplying the first CRC by x^(8 * length2) modulo the polynomial, which is the same
+ * as appending length2 zero bytes to its message. These are the zlib algorithms, where x^(2^n) mod p is looked
+ * up for each set bit of the length so that this only takes O(log(length2)) multiplications.
+ */
+constexpr quint32 multModP(quint32 a, quint32 b)
+{
+    // Multiplies a and b modulo the polynomial, where a must be non-zero
+    quint32 m = quint32(1) << 31;
+    quint32 p = 0;
+    for(;;)
+    {
+        if(a & m)
+        {
+            p ^= b;
+            if((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ LSB_POLYNOMIAL : b >> 1;
+    }
+    return p;
+}
+
+constexpr std::array<quint32, 32> makeX2nTable()
+{
+    std::array<quint32, 32> table{};
+    quint32 p = quint32(1) << 30; // x^1
+    table[0] = p;
+    for(size_t n = 1; n < table.size(); n++)
+        table[n] = p = multModP(p, p);
+    return table;
+}
+
+constexpr std::array<quint32, 32> X2N_TABLE = makeX2nTable();
+
+quint32 x2nModP(quint64 n, unsigned k)
+{
+    // Returns x^(n * 2^k) modulo the polynomial
+    quint32 p = quint32(1) << 31; // x^0
+    for(; n; n >>= 1, k++)
+        if(n & 1)
+            p = multModP(X2N_TABLE[k & 31], p);
+    return p;
+}
+
+// END
+}
+
 namespace Qx
 {
 
@@ -32,26 +272,262 @@ QString Integrity::generateChecksum(QByteArray& data, QCryptographicHash::Algori
  *  Returns the ISO 3309/ITU-T V.42 compliant CRC-32 checksum of @a data.
  *
  *  @note This function will return @c 0 if @a data is empty.
+ *
+ *  @sa Crc32.
  */
 quint32 Integrity::crc32(QByteArrayView data)
 {
-    if(data.isEmpty())
-        return 0;
+    Crc32 crc;
+    crc.update(data);
+    return crc.finalize();
+}
+
+//===============================================================================================================
+// Crc32
+//===============================================================================================================
+
+/*!
+ *  @class Crc32 qx/core/qx-integrity.h
+ *  @ingroup qx-core
+ *
+ *  @brief The Crc32 class incrementally computes an ISO 3309/ITU-T V.42 compliant CRC-32 checksum.
+ *
+ *  Data can be provided in any number of pieces via update(), with the checksum of everything provided so far
+ *  being available at any time from finalize().
+ *
+ *  Bulk data is processed 16 bytes at a time using slicing tables, or, on x86 processors that support it, by
+ *  folding it with carry-less multiplication (PCLMULQDQ).
+ *
+ *  Separate parts of a larger message can also be checksummed independently (e.g. in parallel) and then
+ *  joined together using combine():
+ *
+ *  @code{.cpp}
+ *  Qx::Crc32 first, second;
+ *  first.update(data.first(half));
+ *  second.update(data.sliced(half));
+ *
+ *  first.combine(second); // first.finalize() == Qx::Integrity::crc32(data)
+ *  @endcode
+ *
+ *  @sa Integrity::crc32().
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a CRC-32 accumulator that has not been provided any data.
+ */
+Crc32::Crc32() :
+    mRegister(0xFFFFFFFF),
+    mLength(0)
+{}
+
+//-Class Functions---------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the CRC-32 checksum of the concatenation of two messages, given the checksum of the first message,
+ *  @a crc1, and the checksum and length of the second message, @a crc2 and @a length2 respectively.
+ *
+ *  This takes time proportional to the logarithm of @a length2, instead of its length.
+ */
+quint32 Crc32::combine(quint32 crc1, quint32 crc2, qint64 length2)
+{
+    Q_ASSERT(length2 >= 0);
+    return multModP(x2nModP(static_cast<quint64>(length2), 3), crc1) ^ crc2;
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Adds @a data to the message being checksummed.
+ */
+void Crc32::update(QByteArrayView data)
+{
+    mRegister = updateRegister(mRegister, reinterpret_cast<const uchar*>(data.data()), data.size());
+    mLength += data.size();
+}
+
+/*!
+ *  @overload
+ *
+ *  Appends the message that was checksummed by @a following to the message being checksummed by this
+ *  accumulator, as if all of the data provided to @a following had been provided to this accumulator
+ *  instead.
+ */
+void Crc32::combine(const Crc32& following)
+{
+    mRegister = ~combine(finalize(), following.finalize(), following.mLength);
+    mLength += following.mLength;
+}
+
+/*!
+ *  Resets the accumulator to its initial state, discarding all data provided so far.
+ */
+void Crc32::reset()
+{
+    mRegister = 0xFFFFFFFF;
+    mLength = 0;
+}
+
+/*!
+ *  Returns the CRC-32 checksum of all data provided so far.
+ *
+ *  This does not modify the accumulator, so more data can still be added afterwards.
+ */
+quint32 Crc32::finalize() const { return ~mRegister; }
+
+/*!
+ *  Returns the total number of bytes provided so far.
+ */
+qint64 Crc32::length() const { return mLength; }
+
+//===============================================================================================================
+// Hasher
+//===============================================================================================================
+
+/*!
+ *  @class Hasher qx/core/qx-integrity.h
+ *  @ingroup qx-core
+ *
+ *  @brief The Hasher class incrementally computes the digest of a message using either a cryptographic hash
+ *  algorithm or CRC-32.
+ *
+ *  Unlike Integrity::generateChecksum(), a hasher doesn't need the entire message to be available at once, so
+ *  data can be hashed as it's produced (e.g. while it's being written to a file) instead of needing to be read
+ *  back afterwards. Data can be provided as memory blocks, including memory mapped files, or directly from a
+ *  QIODevice:
+ *
+ *  @code{.cpp}
+ *  Qx::Hasher hasher(QCryptographicHash::Sha256);
+ *  while(producer.hasMore())
+ *  {
+ *      QByteArray chunk = producer.next();
+ *      hasher.addData(chunk);
+ *      file.write(chunk);
+ *  }
+ *
+ *  QByteArray digest = hasher.result();
+ *  @endcode
+ *
+ *  The digest is provided as raw bytes, which can be converted to the typical hexadecimal form with
+ *  QByteArray::toHex() if needed.
+ *
+ *  @sa Crc32 and QCryptographicHash.
+ */
+
+//-Class Enums------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  @enum Hasher::ChecksumAlgorithm
+ *
+ *  This enum specifies the non-cryptographic checksum algorithms that a hasher can use.
+ */
+
+/*!
+ *  @var Hasher::ChecksumAlgorithm Hasher::CRC32
+ *  The CRC-32 checksum, as computed by Crc32.
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a hasher that uses the cryptographic hash algorithm @a algorithm.
+ */
+Hasher::Hasher(QCryptographicHash::Algorithm algorithm) :
+    mCryptoHash(std::in_place, algorithm)
+{}
+
+/*!
+ *  Constructs a hasher that computes a new checksum using the algorithm @a algorithm.
+ */
+Hasher::Hasher(ChecksumAlgorithm algorithm)
+{
+    Q_ASSERT(algorithm == CRC32);
+    Q_UNUSED(algorithm);
+}
 
-    // LSB-first implementation
-    static constexpr quint32 lsbPolynomial = 0xEDB88320;
+/*!
+ *  @overload
+ *
+ *  Constructs a hasher that computes a CRC-32 checksum, continuing on from the state of @a crc.
+ */
+Hasher::Hasher(const Crc32& crc) :
+    mCrc(crc)
+{}
 
-    uint32_t crc = 0xFFFFFFFF;
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns @c true if the hasher computes a CRC-32 checksum; otherwise, returns @c false.
+ */
+bool Hasher::isCrc32() const { return !mCryptoHash; }
 
-    for(quint8 byte : data)
+/*!
+ *  Adds @a data to the message being hashed.
+ *
+ *  A memory mapped file can be hashed without copying by wrapping the address returned by QFile::map() in a
+ *  QByteArrayView.
+ */
+void Hasher::addData(QByteArrayView data)
+{
+    if(mCryptoHash)
+        mCryptoHash->addData(data);
+    else
+        mCrc.update(data);
+}
+
+/*!
+ *  @overload
+ *
+ *  Reads all remaining data from @a device, which must be open for reading, and adds it to the message
+ *  being hashed.
+ *
+ *  Returns @c true if the device was read until its end; otherwise, returns @c false.
+ */
+bool Hasher::addData(QIODevice* device)
+{
+    if(!device || !device->isReadable())
+        return false;
+
+    QByteArray buffer(DEVICE_CHUNK_SIZE, Qt::Uninitialized);
+    for(qint64 read; (read = device->read(buffer.data(), buffer.size())) != 0;)
     {
-        crc ^= byte;
-        for(size_t bit = 8; bit > 0; bit--)
-            crc = crc & 1 ? (crc >> 1) ^ lsbPolynomial : crc >> 1;
+        if(read < 0)
+            return false;
+
+        addData(QByteArrayView(buffer.constData(), read));
     }
 
-    // Return compliment
-    return ~crc;
+    return device->atEnd();
+}
+
+/*!
+ *  Resets the hasher to its initial state, discarding all data provided so far.
+ */
+void Hasher::reset()
+{
+    if(mCryptoHash)
+        mCryptoHash->reset();
+    else
+        mCrc.reset();
+}
+
+/*!
+ *  Returns the digest of all data provided so far.
+ *
+ *  For CRC-32, the checksum is provided in big-endian byte order so that its hexadecimal form matches
+ *  the conventional representation.
+ *
+ *  This does not modify the hasher, so more data can still be added afterwards.
+ */
+QByteArray Hasher::result() const
+{
+    if(mCryptoHash)
+        return mCryptoHash->result();
+
+    QByteArray digest(sizeof(quint32), Qt::Uninitialized);
+    qToBigEndian(mCrc.finalize(), digest.data());
+    return digest;
 }
 
 }
@@ -91,13 +91,40 @@ void PropertyNode::depthAlteringOperation(Operation o)
             d->addOrUpdateDependent(this);
 }
 
-bool PropertyNode::recursiveNodeSearch(const PropertyNode* searchNode, const PropertyNode* target)
+bool PropertyNode::orderedNodeSearch(const PropertyNode* searchNode, const PropertyNode* target)
 {
-    // DFS
-    for(const PropertyNode* dependency : searchNode->mDependencies)
+    /* Node depths double as a running topological order of the graph: a node is always deeper
+     * than any of its dependents, so every dependency that is reachable from 'searchNode' is
+     * deeper than it. This means that 'target' can only be reached if it is deeper than
+     * 'searchNode', and that any node at or beyond the depth of 'target' (that isn't
+     * 'target' itself) can never lead to it. So, we only need to search the slice of the graph
+     * that sits between the two depths (similar to Pearce-Kelly), and not at all if the new
+     * edge already agrees with the order, which is the common case.
+     *
+     * This is iterative and tracks visited nodes so that graphs with a lot of convergence
+     * don't get re-walked through every path, or blow the stack.
+     */
+    const Depth targetDepth = target->depth();
+    if(searchNode->depth() >= targetDepth)
+        return false;
+
+    QVarLengthArray<const PropertyNode*, 32> toVisit{searchNode};
+    QSet<const PropertyNode*> visited{searchNode};
+    while(!toVisit.isEmpty())
     {
-        if(dependency == target || recursiveNodeSearch(dependency, target))
-            return true;
+        const PropertyNode* node = toVisit.last();
+        toVisit.removeLast();
+        for(const PropertyNode* dependency : node->mDependencies)
+        {
+            if(dependency == target)
+                return true;
+
+            if(dependency->depth() < targetDepth && !visited.contains(dependency))
+            {
+                visited.insert(dependency);
+                toVisit.append(dependency);
+            }
+        }
     }
 
     return false;
@@ -105,15 +132,12 @@ bool PropertyNode::recursiveNodeSearch(const PropertyNode* searchNode, const Pro
 
 void PropertyNode::checkForCycle(const PropertyNode* newDependency)
 {
-    /* Uses a DFS to check for a cycle at connection time. A different approach, like those mentioned higher
-     * in this file, could be more efficient.
-     *
-     * TODO: This could cause a stack overflow, but that would likely only happen with a crazy number of node
-     * connections; still, it's something to work around by using an iterative approach instead.
+    /* Checks for a cycle at connection time. A cycle occurs if this node is already a (potentially
+     * indirect) dependency of the new dependency.
      *
      * TODO: Consider making this debug configuration only
      */
-    bool cycle = recursiveNodeSearch(newDependency, this);
+    bool cycle = orderedNodeSearch(newDependency, this);
     if(cycle)
         qFatal("Property dependency cycle occurred while connecting %p to %p", this, newDependency);
 }
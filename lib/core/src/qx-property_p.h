@@ -107,7 +107,7 @@ public:
 private:
     template<typename Operation>
     void depthAlteringOperation(Operation o);
-    bool recursiveNodeSearch(const PropertyNode* searchNode, const PropertyNode* target);
+    bool orderedNodeSearch(const PropertyNode* searchNode, const PropertyNode* target);
     void checkForCycle(const PropertyNode* newDependency);
     void addOrUpdateDependent(PropertyNode* dependent);
     void removeDependency(const PropertyNode* dependency);
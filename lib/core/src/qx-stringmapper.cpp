@@ -0,0 +1,369 @@
+// Unit Includes
+#include "qx/core/qx-stringmapper.h"
+
+// Standard Library Includes
+#include <algorithm>
+
+// Qt Includes
+#include <QStringDecoder>
+#include <QVarLengthArray>
+
+// Extra-component Includes
+#include "qx/utility/qx-helpers.h"
+
+namespace
+{
+
+/* 32 is the same number of expected sections that QString::arg() uses.
+ *
+ * We have to use QAnyStringView here because the pieces can either be a view
+ * of a QString in the replacement map, or a part of the original string which
+ * can be of any string type.
+ */
+using ViewList = QVarLengthArray<QAnyStringView, 32>;
+class StringBlueprint
+{
+    ViewList mViews;
+    qsizetype mLength = 0;
+
+public:
+    StringBlueprint() = default;
+    void push_back(QAnyStringView&& v) { mViews.push_back(v); mLength += v.length(); }
+
+    qsizetype length() const { return mLength; }
+    const ViewList& views() const { return mViews; }
+
+};
+
+inline char16_t codeUnit(char ch) { return static_cast<uchar>(ch); } // Latin-1
+inline char16_t codeUnit(QChar ch) { return ch.unicode(); }
+
+QString assemble(const StringBlueprint& bp)
+{
+    // Form final string from blueprint
+    QString result(bp.length(), Qt::Uninitialized);
+
+    /* Some of this is based on Qt's implementation of QString::arg(). Idk why
+     * they do this instead of just using data(), but who am I to argue with them.
+     * I can only assume it has something to due with the fact that data is always
+     * null terminated but constData may not be.
+     */
+    auto resultRaw = const_cast<QChar*>(result.constData());
+
+    for(const QAnyStringView& view : bp.views())
+    {
+        resultRaw = view.visit(qxFuncAggregate{
+            [resultRaw](QLatin1StringView v){
+                if(v.isEmpty())
+                    return resultRaw;
+
+                thread_local auto fromLatin1 = QStringDecoder(QStringDecoder::Latin1, QStringDecoder::Flag::Stateless);
+                auto postAppend = fromLatin1.appendToBuffer(resultRaw, v);
+                Q_ASSERT(!fromLatin1.hasError());
+                return postAppend;
+            },
+            [resultRaw](QUtf8StringView v){
+                if(v.isEmpty())
+                    return resultRaw;
+
+                thread_local auto fromUtf8 = QStringDecoder(QStringDecoder::Utf8, QStringDecoder::Flag::Stateless);
+                auto postAppend = fromUtf8.appendToBuffer(resultRaw, v);
+                Q_ASSERT(!fromUtf8.hasError());
+                return postAppend;
+            },
+            [resultRaw](QStringView v){
+                if(v.isEmpty())
+                    return resultRaw;
+
+                memcpy(resultRaw, v.data(), v.size() * sizeof(QChar));
+                return resultRaw + v.size();
+            }
+        });
+    }
+
+    /* According to QString::arg(), in the case of UTF-8 decoding, the size of the converted
+     * data might actually be smaller than the string container, so correct for that
+     */
+    result.truncate(resultRaw - result.cbegin());
+
+    return result;
+}
+
+}
+
+namespace Qx
+{
+
+//===============================================================================================================
+// StringMapper
+//===============================================================================================================
+
+/*!
+ *  @class StringMapper qx/core/qx-stringmapper.h
+ *  @ingroup qx-core
+ *
+ *  @brief The StringMapper class replaces every occurrence of a set of keys within a string with corresponding
+ *  values, in a single pass.
+ *
+ *  A string mapper precompiles its key-value map into an Aho-Corasick automaton, which allows it to find all
+ *  occurrences of every key in time proportional to the length of the string being mapped, regardless of how
+ *  many keys there are. As such, when the same map is to be applied to many strings, or to a long string with
+ *  many keys, a string mapper is much faster than repeatedly calling String::mapArg(), which has to prepare
+ *  the map each time.
+ *
+ *  Occurrences are replaced from left to right. When more than one key matches at the same position, the
+ *  shortest one is used, and the text that was replaced is not considered for further matches.
+ *
+ *  @code{.cpp}
+ *  Qx::StringMapper mapper({
+ *      {u"%NAME%"_s, u"Qx"_s},
+ *      {u"%VER%"_s, u"0.5"_s}
+ *  });
+ *
+ *  for(QString& line : templateLines)
+ *      line = mapper.map(line);
+ *  @endcode
+ *
+ *  @sa String::mapArg().
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs an empty string mapper, which leaves strings unchanged.
+ */
+StringMapper::StringMapper() :
+    mCaseSensitivity(Qt::CaseSensitive)
+{}
+
+/*!
+ *  Constructs a string mapper that replaces each key in @a map with its corresponding value, matching keys
+ *  using the case sensitivity setting @a cs.
+ *
+ *  Empty keys are ignored. If @a cs is Qt::CaseInsensitive and multiple keys only differ in case, the first of
+ *  them in @a map is used.
+ */
+StringMapper::StringMapper(const QMap<QString, QString>& map, Qt::CaseSensitivity cs) :
+    mCaseSensitivity(cs)
+{
+    // Build a trie of the keys, with each node's children being temporarily tracked separately
+    QList<QMap<char16_t, qsizetype>> children(1);
+    mNodes.append(Node());
+
+    for(auto [key, value] : map.asKeyValueRange())
+    {
+        if(key.isEmpty())
+            continue;
+
+        qsizetype node = 0;
+        for(QChar ch : key)
+        {
+            char16_t u = unit(ch.unicode());
+            qsizetype child = children.at(node).value(u, 0);
+            if(!child)
+            {
+                child = mNodes.size();
+                children[node].insert(u, child);
+                children.emplaceBack();
+
+                Node n;
+                n.depth = mNodes.at(node).depth + 1;
+                mNodes.append(n);
+            }
+            node = child;
+        }
+
+        Node& end = mNodes[node];
+        if(end.matchReplacement == -1)
+        {
+            end.matchLength = end.depth;
+            end.matchReplacement = mReplacements.size();
+            mReplacements.append(value);
+        }
+    }
+
+    // Flatten children into sorted edge runs
+    for(qsizetype node = 0; node < mNodes.size(); ++node)
+    {
+        const auto& kids = children.at(node);
+        Node& n = mNodes[node];
+        n.firstEdge = mEdges.size();
+        n.edgeCount = kids.size();
+        for(auto [ch, child] : kids.asKeyValueRange())
+            mEdges.append(Edge{ch, child});
+    }
+
+    // Direct lookup for the root's transitions on common characters, since most scanning happens there
+    mRootTable.resize(ROOT_TABLE_SIZE);
+    for(char16_t ch = 0; ch < ROOT_TABLE_SIZE; ++ch)
+        mRootTable[ch] = edge(0, ch);
+
+    /* Failure links, in breadth-first order so that the target of each link is always complete by the
+     * time it's needed. Each node also inherits the longest key that ends at its failure target if it
+     * doesn't end a key itself, which makes it the longest key that ends at that node.
+     */
+    QList<qsizetype> queue;
+    queue.reserve(mNodes.size());
+    queue.append(0);
+    for(qsizetype q = 0; q < queue.size(); ++q)
+    {
+        qsizetype node = queue.at(q);
+        const Node parent = mNodes.at(node);
+        for(qsizetype e = parent.firstEdge; e < parent.firstEdge + parent.edgeCount; ++e)
+        {
+            const Edge& ed = mEdges.at(e);
+            Node& child = mNodes[ed.target];
+            child.fail = node == 0 ? 0 : step(parent.fail, ed.ch);
+            if(child.matchReplacement == -1)
+            {
+                const Node& fail = mNodes.at(child.fail);
+                child.matchLength = fail.matchLength;
+                child.matchReplacement = fail.matchReplacement;
+            }
+            queue.append(ed.target);
+        }
+    }
+}
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Private:
+char16_t StringMapper::unit(char16_t ch) const
+{
+    return mCaseSensitivity == Qt::CaseInsensitive ? QChar(ch).toCaseFolded().unicode() : ch;
+}
+
+qsizetype StringMapper::edge(qsizetype node, char16_t ch) const
+{
+    // Returns the child of node reached via ch, or 0 (root) if there is none
+    const Node& n = mNodes.at(node);
+    const Edge* begin = mEdges.constData() + n.firstEdge;
+    const Edge* end = begin + n.edgeCount;
+
+    if(n.edgeCount <= 8)
+    {
+        for(const Edge* e = begin; e != end; ++e)
+            if(e->ch == ch)
+                return e->target;
+        return 0;
+    }
+
+    const Edge* e = std::lower_bound(begin, end, ch, [](const Edge& e, char16_t c){ return e.ch < c; });
+    return e != end && e->ch == ch ? e->target : 0;
+}
+
+qsizetype StringMapper::step(qsizetype node, char16_t ch) const
+{
+    forever
+    {
+        if(node == 0)
+            return ch < ROOT_TABLE_SIZE ? mRootTable.at(ch) : edge(0, ch);
+        if(qsizetype next = edge(node, ch))
+            return next;
+        node = mNodes.at(node).fail;
+    }
+}
+
+template<typename Char, typename Report>
+void StringMapper::scan(const Char* chars, qsizetype length, Report report) const
+{
+    /* Reports leftmost, then shortest, non-overlapping matches via report(start, length, replacement).
+     *
+     * The automaton reports matches by where they end, so a match that's found isn't necessarily the leftmost
+     * one, as a longer key that started earlier may still be in progress. The depth of the current node is the
+     * length of the longest in-progress key prefix, so once that no longer reaches back to the start of the
+     * best match so far, that match can't be beaten and is accepted. Scanning then resumes just after it, from
+     * the root, so that text that was replaced isn't used for other matches.
+     */
+    qsizetype node = 0;
+    qsizetype bestStart = -1;
+    qsizetype bestLength = 0;
+    qsizetype bestReplacement = -1;
+
+    for(qsizetype i = 0; ; ++i)
+    {
+        if(i < length)
+        {
+            node = step(node, unit(codeUnit(chars[i])));
+            const Node& n = mNodes.at(node);
+
+            // The longest key ending here is the one that started earliest
+            if(n.matchLength)
+            {
+                qsizetype start = i - n.matchLength + 1;
+                if(bestStart == -1 || start < bestStart)
+                {
+                    bestStart = start;
+                    bestLength = n.matchLength;
+                    bestReplacement = n.matchReplacement;
+                }
+            }
+
+            if(bestStart == -1 || i - n.depth + 1 <= bestStart)
+                continue;
+        }
+        else if(bestStart == -1)
+            break;
+
+        // Accept match
+        report(bestStart, bestLength, bestReplacement);
+        i = bestStart + bestLength - 1;
+        node = 0;
+        bestStart = -1;
+    }
+}
+
+//Public:
+/*!
+ *  Returns @c true if the mapper has no keys; otherwise, returns @c false.
+ */
+bool StringMapper::isEmpty() const { return mReplacements.isEmpty(); }
+
+/*!
+ *  Returns the number of keys the mapper replaces.
+ */
+qsizetype StringMapper::count() const { return mReplacements.size(); }
+
+/*!
+ *  Returns the case sensitivity setting used when matching keys.
+ */
+Qt::CaseSensitivity StringMapper::caseSensitivity() const { return mCaseSensitivity; }
+
+/*!
+ *  Returns a copy of @a s with all occurrences of each of the mapper's keys replaced with their corresponding
+ *  value.
+ *
+ *  Like String::mapArg(), this only performs one heap allocation for the final string when @a s is
+ *  Latin-1 or UTF-16 encoded. UTF-8 encoded strings are first converted to UTF-16.
+ */
+QString StringMapper::map(QAnyStringView s) const
+{
+    if(s.isEmpty() || isEmpty())
+        return s.toString();
+
+    // Create blueprint for the final string
+    QString decoded; // Storage for sources that have to be scanned as UTF-16
+    StringBlueprint resultBp;
+    auto build = [&](auto view) {
+        qsizetype segStart = 0;
+        scan(view.data(), view.size(), [&](qsizetype start, qsizetype length, qsizetype replacement){
+            if(start != segStart)
+                resultBp.push_back(view.sliced(segStart, start - segStart)); // Preceding raw characters
+            resultBp.push_back(QStringView(mReplacements.at(replacement))); // Subbed Characters
+            segStart = start + length; // Note next segment start
+        });
+
+        // Check for trailing text
+        if(segStart < view.size())
+            resultBp.push_back(view.sliced(segStart));
+    };
+
+    s.visit(qxFuncAggregate{
+        [&](QLatin1StringView v){ build(v); },
+        [&](QUtf8StringView v){ decoded = v.toString(); build(QStringView(decoded)); },
+        [&](QStringView v){ build(v); }
+    });
+
+    return assemble(resultBp);
+}
+
+}
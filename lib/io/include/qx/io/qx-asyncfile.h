@@ -0,0 +1,80 @@
+#ifndef QX_ASYNCFILE_H
+#define QX_ASYNCFILE_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Standard Library Includes
+#include <memory>
+#include <span>
+
+// Qt Includes
+#include <QFile>
+#include <QFuture>
+
+// Intra-component Includes
+#include "qx/io/qx-ioopreport.h"
+
+namespace Qx
+{
+
+class AsyncFileEngine;
+
+class QX_IO_EXPORT AsyncFile
+{
+//-Inner Classes----------------------------------------------------------------------------------------------------
+public:
+    class Batch;
+
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    QFile mFile;
+    std::unique_ptr<AsyncFileEngine> mEngine;
+    int mBatchDepth;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    explicit AsyncFile(const QString& fileName);
+
+//-Destructor-------------------------------------------------------------------------------------------------------
+public:
+    ~AsyncFile();
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+private:
+    QFuture<IoOpReport> enqueue(IoOpType type, std::byte* data, qint64 size, qint64 pos);
+
+public:
+    QString fileName() const;
+    bool isOpen() const;
+
+    IoOpReport open(QIODevice::OpenMode openMode);
+    void close();
+
+    bool registerBuffers(const QList<std::span<std::byte>>& buffers);
+    void unregisterBuffers();
+
+    QFuture<IoOpReport> read(std::span<std::byte> buffer, qint64 pos);
+    QFuture<IoOpReport> write(std::span<const std::byte> data, qint64 pos);
+    void waitForDone();
+};
+
+class QX_IO_EXPORT AsyncFile::Batch
+{
+    Q_DISABLE_COPY_MOVE(Batch);
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    AsyncFile& mFile;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    explicit Batch(AsyncFile& file);
+
+//-Destructor-------------------------------------------------------------------------------------------------------
+public:
+    ~Batch();
+};
+
+}
+
+#endif // QX_ASYNCFILE_H
@@ -0,0 +1,86 @@
+#ifndef QX_CHECKSUMENGINE_H
+#define QX_CHECKSUMENGINE_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Qt Includes
+#include <QCryptographicHash>
+#include <QFuture>
+#include <QStringList>
+#include <QThread>
+#include <QThreadPool>
+
+// Intra-component Includes
+#include "qx/io/qx-ioopreport.h"
+
+namespace Qx
+{
+
+class QX_IO_EXPORT ChecksumEngine
+{
+//-Class Variables------------------------------------------------------------------------------------------------
+public:
+    static constexpr qsizetype DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+//-Inner Classes--------------------------------------------------------------------------------------------------
+public:
+    class QX_IO_EXPORT Result
+    {
+        friend class ChecksumEngine;
+    //-Instance Variables------------------------------------------------------------------------------------------
+    private:
+        QString mFilePath;
+        QString mChecksum;
+        IoOpReport mReport;
+
+    //-Constructor-------------------------------------------------------------------------------------------------
+    private:
+        Result(const QString& filePath, const QString& checksum, const IoOpReport& report);
+
+    public:
+        Result();
+
+    //-Instance Functions------------------------------------------------------------------------------------------
+    public:
+        QString filePath() const;
+        QString checksum() const;
+        IoOpReport report() const;
+        bool isFailure() const;
+        bool matches(QStringView checksum) const;
+    };
+
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    QCryptographicHash::Algorithm mAlgorithm;
+    qsizetype mBufferSize;
+    QThreadPool mPool;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    explicit ChecksumEngine(QCryptographicHash::Algorithm algorithm, int maxThreadCount = QThread::idealThreadCount());
+
+//-Destructor-------------------------------------------------------------------------------------------------------
+public:
+    ~ChecksumEngine();
+
+//-Class Functions------------------------------------------------------------------------------------------------
+private:
+    static Result hashFile(const QString& filePath, QCryptographicHash::Algorithm algorithm, qsizetype bufferSize);
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+public:
+    QCryptographicHash::Algorithm algorithm() const;
+    int maxThreadCount() const;
+    qsizetype bufferSize() const;
+
+    void setMaxThreadCount(int maxThreadCount);
+    void setBufferSize(qsizetype size);
+
+    QFuture<Result> hashFiles(const QStringList& filePaths);
+    void waitForDone();
+};
+
+}
+
+#endif // QX_CHECKSUMENGINE_H
@@ -4,6 +4,9 @@
 // Shared Lib Support
 #include "qx/io/qx_io_export.h"
 
+// Standard Library Includes
+#include <span>
+
 // Qt Includes
 #include <QFlags>
 #include <QChar>
@@ -13,6 +16,8 @@
 #include <QCryptographicHash>
 
 //Intra-component Includes
+#include "qx/io/qx-direntry.h"
+#include "qx/io/qx-filemapping.h"
 #include "qx/io/qx-ioopreport.h"
 #include "qx/io/qx-textpos.h"
 #include "qx/io/qx-textquery.h"
@@ -22,6 +27,8 @@
 
 namespace Qx
 {
+class TextFileIndex;
+
 //-Namespace Enums-----------------------------------------------------------------------------------------------------
 enum ReplaceMode {Replace, Skip, Stop};
 enum WriteMode {Insert, Overwrite, Append, Truncate};
@@ -62,12 +69,16 @@ QX_IO_EXPORT bool createFile(const QString& fileName);
 QX_IO_EXPORT IoOpReport textFileEndsWithNewline(bool& returnBuffer, QFile& textFile);
 QX_IO_EXPORT IoOpReport textFileLayout(QList<int>& returnBuffer, QFile& textFile, bool ignoreTrailingEmpty);
 QX_IO_EXPORT IoOpReport textFileLineCount(int& returnBuffer, QFile& textFile, bool ignoreTrailingEmpty);
+QX_IO_EXPORT IoOpReport textFileLineCount(int& returnBuffer, QFile& textFile, const TextFileIndex& index, bool ignoreTrailingEmpty);
 QX_IO_EXPORT IoOpReport textFileAbsolutePosition(TextPos& textPos, QFile& textFile, bool ignoreTrailingEmpty);
+QX_IO_EXPORT IoOpReport textFileAbsolutePosition(TextPos& textPos, QFile& textFile, const TextFileIndex& index, bool ignoreTrailingEmpty);
 QX_IO_EXPORT IoOpReport findStringInFile(QList<TextPos>& returnBuffer, QFile& textFile, const TextQuery& query, ReadOptions readOptions = NoReadOptions);
 QX_IO_EXPORT IoOpReport fileContainsString(bool& returnBuffer, QFile& textFile, const QString& query, Qt::CaseSensitivity caseSensitivity = Qt::CaseSensitive, bool allowSplit = false);
 QX_IO_EXPORT IoOpReport readTextFromFile(QString& returnBuffer, QFile& textFile, TextPos startPos, int count, ReadOptions readOptions = NoReadOptions);
 QX_IO_EXPORT IoOpReport readTextFromFile(QString& returnBuffer, QFile& textFile, TextPos startPos = TextPos(Start), TextPos endPos = TextPos(End), ReadOptions readOptions = NoReadOptions);
 QX_IO_EXPORT IoOpReport readTextFromFile(QStringList& returnBuffer, QFile& textFile, Index32 startLine = 0, Index32 endLine = Index32(Last), ReadOptions readOptions = NoReadOptions);
+QX_IO_EXPORT IoOpReport readTextFromFile(QStringList& returnBuffer, QFile& textFile, const TextFileIndex& index, Index32 startLine = 0,
+                                         Index32 endLine = Index32(Last), ReadOptions readOptions = NoReadOptions);
 QX_IO_EXPORT IoOpReport writeStringToFile(QFile& textFile, const QString& text, WriteMode writeMode = Truncate, TextPos startPos = TextPos(Start), WriteOptions writeOptions = NoWriteOptions);
 QX_IO_EXPORT IoOpReport writeStringToFile(QSaveFile& textFile, const QString& text, WriteMode writeMode = Truncate, TextPos startPos = TextPos(Start), WriteOptions writeOptions = NoWriteOptions);
 QX_IO_EXPORT IoOpReport deleteTextFromFile(QFile& textFile, TextPos startPos, TextPos endPos);
@@ -77,6 +88,8 @@ QX_IO_EXPORT bool dirContainsFiles(const QDir& directory, QDirIterator::Iterator
 QX_IO_EXPORT IoOpReport dirContainsFiles(bool& returnBuffer, const QDir& directory, QDirIterator::IteratorFlags iteratorFlags);
 QX_IO_EXPORT IoOpReport dirContentInfoList(QFileInfoList& returnBuffer, const QDir& directory, QStringList nameFilters = QStringList(),
                                            QDir::Filters filters = QDir::NoFilter, QDirIterator::IteratorFlags flags = QDirIterator::NoIteratorFlags);
+QX_IO_EXPORT IoOpReport dirContentEntryList(QList<DirEntry>& returnBuffer, const QDir& directory, QStringList nameFilters = QStringList(),
+                                            QDir::Filters filters = QDir::NoFilter, QDirIterator::IteratorFlags flags = QDirIterator::NoIteratorFlags);
 QX_IO_EXPORT IoOpReport dirContentList(QStringList& returnBuffer, const QDir& directory, QStringList nameFilters = QStringList(),
                                        QDir::Filters filters = QDir::NoFilter, QDirIterator::IteratorFlags flags = QDirIterator::NoIteratorFlags, PathType pathType = Absolute);
 QX_IO_EXPORT IoOpReport copyDirectory(const QDir& directory, const QDir& destination, bool recursive = true, ReplaceMode replaceMode = Stop);
@@ -87,6 +100,8 @@ QX_IO_EXPORT IoOpReport fileMatchesChecksum(bool& returnBuffer, QFile& file, QSt
 
 // Binary Based
 QX_IO_EXPORT IoOpReport readBytesFromFile(QByteArray& returnBuffer, QFile& file, Index64 startPos = 0, Index64 endPos = Index64(Last));
+QX_IO_EXPORT IoOpReport readBytesFromFile(std::span<std::byte> returnBuffer, qint64& bytesRead, QFile& file, Index64 startPos = 0);
+QX_IO_EXPORT IoOpReport mapBytesFromFile(FileMapping& returnBuffer, QFile& file, Index64 startPos = 0, Index64 endPos = Index64(Last));
 QX_IO_EXPORT IoOpReport writeBytesToFile(QFile& file, const QByteArray& bytes, WriteMode writeMode = Truncate, Index64 startPos = 0, WriteOptions writeOptions = NoWriteOptions);
 QX_IO_EXPORT IoOpReport writeBytesToFile(QSaveFile& file, const QByteArray& bytes, WriteMode writeMode = Truncate, Index64 startPos = 0, WriteOptions writeOptions = NoWriteOptions);
 }
@@ -0,0 +1,60 @@
+#ifndef QX_DIRECTORYCOPIER_H
+#define QX_DIRECTORYCOPIER_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Qt Includes
+#include <QDir>
+#include <QFuture>
+#include <QThread>
+#include <QThreadPool>
+
+// Intra-component Includes
+#include "qx/io/qx-common-io.h"
+#include "qx/io/qx-ioopreport.h"
+
+namespace Qx
+{
+
+class QX_IO_EXPORT DirectoryCopier
+{
+//-Class Variables------------------------------------------------------------------------------------------------
+private:
+    static constexpr int QUEUED_COPIES_PER_THREAD = 8;
+    static constexpr int PROGRESS_RANGE_INTERVAL = 256;
+
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    ReplaceMode mReplaceMode;
+    QThreadPool mPool;
+    QThreadPool mEnumerationPool;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    explicit DirectoryCopier(ReplaceMode replaceMode = Stop, int maxThreadCount = QThread::idealThreadCount());
+
+//-Destructor-------------------------------------------------------------------------------------------------------
+public:
+    ~DirectoryCopier();
+
+//-Class Functions------------------------------------------------------------------------------------------------
+private:
+    static IoOpReport copyFile(const QString& source, const QString& destination, ReplaceMode replaceMode);
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+public:
+    ReplaceMode replaceMode() const;
+    int maxThreadCount() const;
+
+    void setReplaceMode(ReplaceMode replaceMode);
+    void setMaxThreadCount(int maxThreadCount);
+
+    QFuture<IoOpReport> copy(const QDir& directory, const QDir& destination, bool recursive = true);
+    QFuture<IoOpReport> copy(const QDir& directory, const QDir& destination, bool recursive, ReplaceMode replaceMode);
+    void waitForDone();
+};
+
+}
+
+#endif // QX_DIRECTORYCOPIER_H
@@ -0,0 +1,48 @@
+#ifndef QX_DIRENTRY_H
+#define QX_DIRENTRY_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Qt Includes
+#include <QFileInfo>
+#include <QString>
+
+namespace Qx
+{
+
+class QX_IO_EXPORT DirEntry
+{
+//-Class Enums-------------------------------------------------------------------------------------------------------
+public:
+    enum Type { Null, File, Directory, Other };
+
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    QString mPath;
+    Type mType;
+    bool mSymLink;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    DirEntry();
+    DirEntry(const QString& path, Type type, bool symLink = false);
+    explicit DirEntry(const QFileInfo& fileInfo);
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+public:
+    bool isNull() const;
+    QString path() const;
+    QString fileName() const;
+    Type type() const;
+    bool isFile() const;
+    bool isDir() const;
+    bool isSymLink() const;
+    QFileInfo fileInfo() const;
+
+    bool operator==(const DirEntry& other) const = default;
+};
+
+}
+
+#endif // QX_DIRENTRY_H
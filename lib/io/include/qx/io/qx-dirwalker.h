@@ -0,0 +1,62 @@
+#ifndef QX_DIRWALKER_H
+#define QX_DIRWALKER_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Standard Library Includes
+#include <functional>
+
+// Qt Includes
+#include <QDir>
+#include <QFuture>
+#include <QThread>
+#include <QThreadPool>
+
+// Intra-component Includes
+#include "qx/io/qx-direntry.h"
+#include "qx/io/qx-ioopreport.h"
+
+namespace Qx
+{
+
+class QX_IO_EXPORT DirWalker
+{
+//-Class Types----------------------------------------------------------------------------------------------
+public:
+    using Visitor = std::function<void(const DirEntry&)>;
+
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    QStringList mNameFilters;
+    QDir::Filters mFilters;
+    int mMaxDepth;
+    QThreadPool mPool;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    explicit DirWalker(int maxThreadCount = QThread::idealThreadCount());
+
+//-Destructor-------------------------------------------------------------------------------------------------------
+public:
+    ~DirWalker();
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+public:
+    QStringList nameFilters() const;
+    QDir::Filters filters() const;
+    int maxDepth() const;
+    int maxThreadCount() const;
+
+    void setNameFilters(const QStringList& nameFilters);
+    void setFilters(QDir::Filters filters);
+    void setMaxDepth(int maxDepth);
+    void setMaxThreadCount(int maxThreadCount);
+
+    QFuture<IoOpReport> walk(const QDir& directory, const Visitor& visitor);
+    void waitForDone();
+};
+
+}
+
+#endif // QX_DIRWALKER_H
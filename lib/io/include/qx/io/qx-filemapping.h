@@ -0,0 +1,59 @@
+#ifndef QX_FILEMAPPING_H
+#define QX_FILEMAPPING_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Standard Library Includes
+#include <span>
+
+// Qt Includes
+#include <QByteArrayView>
+#include <QFile>
+
+// Intra-component Includes
+#include "qx/io/qx-ioopreport.h"
+
+// Extra-component Includes
+#include "qx/core/qx-index.h"
+
+namespace Qx
+{
+
+class QX_IO_EXPORT FileMapping
+{
+    Q_DISABLE_COPY(FileMapping);
+    friend IoOpReport mapBytesFromFile(FileMapping& returnBuffer, QFile& file, Index64 startPos, Index64 endPos);
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    QFileDevice* mFile;
+    uchar* mData;
+    qint64 mSize;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+private:
+    FileMapping(QFileDevice& file, uchar* data, qint64 size);
+
+public:
+    FileMapping();
+    FileMapping(FileMapping&& other);
+
+//-Destructor-------------------------------------------------------------------------------------------------------
+public:
+    ~FileMapping();
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+public:
+    bool isNull() const;
+    const char* data() const;
+    qint64 size() const;
+    QByteArrayView view() const;
+    std::span<const std::byte> bytes() const;
+    void unmap();
+
+    FileMapping& operator=(FileMapping&& other);
+};
+
+}
+
+#endif // QX_FILEMAPPING_H
@@ -4,13 +4,21 @@
 // Shared Lib Support
 #include "qx/io/qx_io_export.h"
 
+// Standard Library Includes
+#include <memory>
+
 // Qt Includes
+#include <QBuffer>
 #include <QDataStream>
 #include <QFile>
+#include <QThreadPool>
 
 // Intra-component Includes
 #include "qx/io/qx-common-io.h"
 
+// Extra-component Includes
+#include "qx/core/qx-integrity.h"
+
 namespace Qx
 {
 	
@@ -24,6 +32,17 @@ private:
     WriteOptions mWriteOptions;
     IoOpReport mStatus;
 
+    // Buffered mode, whose buffer and flush thread only exist while they're in use
+    qsizetype mBufferSize;
+    bool mBackgroundFlush;
+    std::unique_ptr<QBuffer> mBuffer;
+    QByteArray mBackBuffer;
+    IoOpReport mBackStatus;
+    std::unique_ptr<QThreadPool> mFlushPool;
+
+    // Hashing
+    Hasher* mHasher;
+
 //-Constructor-------------------------------------------------------------------------------------------------------
 public:
     FileStreamWriter(WriteMode writeMode = Append, WriteOptions writeOptions = NoWriteOptions);
@@ -39,6 +58,9 @@ private:
     IoOpReport preWriteErrorCheck();
     void setFile(const QString& filePath);
     void unsetFile();
+    IoOpReport writeBuffer(const QByteArray& data);
+    void collectBackgroundFlush();
+    void flushBuffer();
 
 public:
     // Stock functions
@@ -55,6 +77,19 @@ public:
         requires defines_left_shift_for<QDataStream, T>
     FileStreamWriter& operator<<(T d)
     {
+        // Status is only checked when a full buffer is flushed
+        if(mBuffer)
+        {
+            if(!hasError())
+            {
+                mStreamWriter << d;
+                if(mBuffer->data().size() >= mBufferSize)
+                    flushBuffer();
+            }
+
+            return *this;
+        }
+
         IoOpReport check = preWriteErrorCheck();
 
         if(!check.isFailure())
@@ -70,6 +105,14 @@ public:
     void setFilePath(const QString& filePath);
 
     // New functions
+    qsizetype bufferSize() const;
+    void setBufferSize(qsizetype size);
+    bool backgroundFlush() const;
+    void setBackgroundFlush(bool enabled);
+    Hasher* hasher() const;
+    void setHasher(Hasher* hasher);
+    IoOpReport flush();
+
     bool hasError() const;
     IoOpReport openFile();
     void closeFile();
@@ -0,0 +1,70 @@
+#ifndef QX_TEXTFILEINDEX_H
+#define QX_TEXTFILEINDEX_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Qt Includes
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QList>
+
+// Intra-component Includes
+#include "qx/io/qx-ioopreport.h"
+
+namespace Qx
+{
+
+class QX_IO_EXPORT TextFileIndex
+{
+//-Class Variables------------------------------------------------------------------------------------------------
+private:
+    static constexpr int BLOCK_SIZE = 64; // Lines per absolute offset
+    static constexpr quint32 OVERFLOW_OFFSET = 0xFFFFFFFF;
+    static constexpr qint64 READ_CHUNK_SIZE = 1024 * 1024;
+    static constexpr quint32 SIDECAR_MAGIC = 0x51585449; // "QXTI"
+    static constexpr quint16 SIDECAR_VERSION = 1;
+
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    bool mNull;
+    qint64 mFileSize;
+    qint64 mLastModified;
+    bool mEndsWithBreak;
+    QList<qint64> mBlockOffsets;
+    QList<quint32> mLineOffsets; // Relative to the line's block
+    QHash<int, qint64> mOverflowOffsets; // For lines too far from their block's start
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    TextFileIndex();
+
+//-Class Functions---------------------------------------------------------------------------------------------------
+private:
+    static qint64 lastModified(const QFileInfo& fileInfo);
+
+public:
+    static IoOpReport build(TextFileIndex& returnBuffer, QFile& textFile);
+    static IoOpReport load(TextFileIndex& returnBuffer, QFile& indexFile, const QFile& textFile);
+    static IoOpReport buildCached(TextFileIndex& returnBuffer, QFile& textFile, QFile& indexFile);
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+private:
+    void appendLine(qint64 offset);
+
+public:
+    bool isNull() const;
+    bool isCurrent(const QFile& textFile) const;
+
+    qint64 fileSize() const;
+    bool endsWithBreak() const;
+    int lineCount(bool ignoreTrailingEmpty = false) const;
+    qint64 lineOffset(int line) const;
+
+    IoOpReport save(QFile& indexFile) const;
+};
+
+}
+
+#endif // QX_TEXTFILEINDEX_H
@@ -0,0 +1,91 @@
+#ifndef QX_TEXTSEARCHER_H
+#define QX_TEXTSEARCHER_H
+
+// Shared Lib Support
+#include "qx/io/qx_io_export.h"
+
+// Standard Library Includes
+#include <memory>
+
+// Qt Includes
+#include <QDirIterator>
+#include <QFuture>
+#include <QStringList>
+#include <QThread>
+#include <QThreadPool>
+
+// Intra-component Includes
+#include "qx/io/qx-common-io.h"
+#include "qx/io/qx-ioopreport.h"
+#include "qx/io/qx-textpos.h"
+#include "qx/io/qx-textquery.h"
+
+namespace Qx
+{
+
+class TextQuerySet;
+
+class QX_IO_EXPORT TextSearcher
+{
+//-Inner Classes--------------------------------------------------------------------------------------------------
+public:
+    class QX_IO_EXPORT Result
+    {
+        friend class TextSearcher;
+    //-Instance Variables------------------------------------------------------------------------------------------
+    private:
+        QString mFilePath;
+        QList<QList<TextPos>> mHits;
+        IoOpReport mReport;
+
+    //-Constructor-------------------------------------------------------------------------------------------------
+    private:
+        Result(const QString& filePath, const QList<QList<TextPos>>& hits, const IoOpReport& report);
+
+    public:
+        Result();
+
+    //-Instance Functions------------------------------------------------------------------------------------------
+    public:
+        QString filePath() const;
+        QList<TextPos> hits(qsizetype queryIndex) const;
+        bool hasHits() const;
+        IoOpReport report() const;
+        bool isFailure() const;
+    };
+
+//-Instance Variables------------------------------------------------------------------------------------------------
+private:
+    std::unique_ptr<TextQuerySet> mQuerySet;
+    ReadOptions mReadOptions;
+    QThreadPool mPool;
+
+//-Constructor-------------------------------------------------------------------------------------------------------
+public:
+    explicit TextSearcher(const QList<TextQuery>& queries, ReadOptions readOptions = NoReadOptions,
+                          int maxThreadCount = QThread::idealThreadCount());
+
+//-Destructor-------------------------------------------------------------------------------------------------------
+public:
+    ~TextSearcher();
+
+//-Class Functions------------------------------------------------------------------------------------------------
+private:
+    static Result searchFile(const QString& filePath, const TextQuerySet& querySet, ReadOptions readOptions);
+
+//-Instance Functions------------------------------------------------------------------------------------------------
+public:
+    QList<TextQuery> queries() const;
+    ReadOptions readOptions() const;
+    int maxThreadCount() const;
+
+    void setMaxThreadCount(int maxThreadCount);
+
+    QFuture<Result> search(const QStringList& filePaths);
+    QFuture<Result> search(QDirIterator& iterator);
+    void waitForDone();
+};
+
+}
+
+#endif // QX_TEXTSEARCHER_H
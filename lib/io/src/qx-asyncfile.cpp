@@ -0,0 +1,396 @@
+// Unit Includes
+#include "qx/io/qx-asyncfile.h"
+#include "qx-asyncfile_p.h"
+
+// Qt Includes
+#include <QFileInfo>
+
+// Intra-component Includes
+#include "qx-common-io_p.h"
+
+namespace Qx
+{
+/*! @cond */
+//===============================================================================================================
+// AsyncFileEngine
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+AsyncFileEngine::AsyncFileEngine(const QFileInfo& target) :
+    mTarget(target),
+    mOutstanding(0),
+    mDeferred(false)
+{}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Protected:
+void AsyncFileEngine::finish(std::unique_ptr<AsyncFileOperation> op, IoOpResultType result)
+{
+    op->promise.addResult(IoOpReport(op->type, result, mTarget));
+    op->promise.finish();
+
+    QMutexLocker locker(&mMutex);
+    if(--mOutstanding == 0)
+        mDone.wakeAll();
+}
+
+void AsyncFileEngine::finishFailed(QMutexLocker<QMutex>& locker)
+{
+    while(!mFailed.empty())
+    {
+        auto failed = std::move(mFailed);
+        mFailed.clear();
+
+        locker.unlock();
+        for(auto& [op, result] : failed)
+            finish(std::move(op), result);
+        locker.relock();
+    }
+}
+
+//Public:
+QFuture<IoOpReport> AsyncFileEngine::enqueue(IoOpType type, std::byte* data, qint64 size, qint64 pos)
+{
+    auto op = std::make_unique<AsyncFileOperation>();
+    op->type = type;
+    op->data = data;
+    op->size = size;
+    op->pos = pos;
+
+    QFuture<IoOpReport> future = op->promise.future();
+    op->promise.start();
+
+    if(size == 0)
+    {
+        op->promise.addResult(IoOpReport(type, IO_SUCCESS, mTarget));
+        op->promise.finish();
+        return future;
+    }
+
+    QMutexLocker locker(&mMutex);
+    ++mOutstanding;
+    mQueued.push_back(std::move(op));
+    if(!mDeferred)
+    {
+        flush();
+        finishFailed(locker);
+    }
+
+    return future;
+}
+
+void AsyncFileEngine::setDeferred(bool deferred)
+{
+    QMutexLocker locker(&mMutex);
+    mDeferred = deferred;
+    if(!mDeferred && !mQueued.empty())
+    {
+        flush();
+        finishFailed(locker);
+    }
+}
+
+void AsyncFileEngine::waitForDone()
+{
+    QMutexLocker locker(&mMutex);
+    if(!mQueued.empty())
+    {
+        flush();
+        finishFailed(locker);
+    }
+    while(mOutstanding != 0)
+        mDone.wait(&mMutex);
+}
+
+bool AsyncFileEngine::registerBuffers(const QList<std::span<std::byte>>& buffers)
+{
+    // Nothing to gain without a native engine
+    Q_UNUSED(buffers);
+    return false;
+}
+
+void AsyncFileEngine::unregisterBuffers() {}
+
+//===============================================================================================================
+// ThreadPoolFileEngine
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+ThreadPoolFileEngine::ThreadPoolFileEngine(QFileDevice& file, const QFileInfo& target) :
+    AsyncFileEngine(target),
+    mFile(file)
+{}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+ThreadPoolFileEngine::~ThreadPoolFileEngine() { waitForDone(); }
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Private:
+void ThreadPoolFileEngine::flush()
+{
+    while(!mQueued.empty())
+    {
+        AsyncFileOperation* op = mQueued.front().release();
+        mQueued.pop_front();
+
+        mPool.start([this, op]{
+            std::unique_ptr<AsyncFileOperation> owned(op);
+            IoOpResultType result;
+
+            if(owned->type == IO_OP_READ)
+            {
+                qint64 bytesRead;
+                result = nativeReadAt(mFile, owned->pos, std::span(owned->data, owned->size), bytesRead);
+                if(result == IO_SUCCESS && bytesRead != owned->size)
+                    result = IO_ERR_FILE_SIZE_MISMATCH;
+            }
+            else
+                result = nativeWriteAt(mFile, owned->pos, std::span(owned->data, owned->size));
+
+            finish(std::move(owned), result);
+        });
+    }
+}
+/*! @endcond */
+
+//===============================================================================================================
+// AsyncFile
+//===============================================================================================================
+
+/*!
+ *  @class AsyncFile qx/io/qx-asyncfile.h
+ *  @ingroup qx-io
+ *
+ *  @brief The AsyncFile class provides non-blocking reads and writes at arbitrary positions within a file.
+ *
+ *  The other functions and classes of this module block the calling thread until each operation is complete,
+ *  so issuing many operations at once requires a thread for each. An async file instead returns a future for
+ *  each read or write as soon as it's issued, which allows any number of them to be in flight at once without
+ *  dedicating a thread to any of them.
+ *
+ *  On Linux, operations are performed with @c io_uring when the kernel supports it, such that all of them are
+ *  handled by the kernel directly and completions are collected by a single thread. Elsewhere, or when
+ *  @c io_uring is unavailable, operations are performed as positional transfers on a thread pool, which
+ *  provides the same interface and semantics.
+ *
+ *  @code{.cpp}
+ *  Qx::AsyncFile pack(u"assets.pak"_s);
+ *  pack.open(QIODevice::ReadOnly);
+ *
+ *  QList<QByteArray> records(index.size());
+ *  QList<QFuture<Qx::IoOpReport>> reads;
+ *  {
+ *      Qx::AsyncFile::Batch batch(pack); // Submit all reads at once
+ *      for(qsizetype i = 0; i < index.size(); ++i)
+ *      {
+ *          records[i].resize(index[i].size);
+ *          reads.append(pack.read(std::as_writable_bytes(std::span(records[i])), index[i].offset));
+ *      }
+ *  }
+ *
+ *  for(const QFuture<Qx::IoOpReport>& read : reads)
+ *      if(read.result().isFailure())
+ *          qWarning() << read.result().outcomeInfo();
+ *  @endcode
+ *
+ *  The memory that is read into or written from must remain valid and untouched until the corresponding
+ *  future has finished. Operations are independent of one another and may complete in any order, even
+ *  those that overlap. Canceling a future has no effect on its operation.
+ *
+ *  An async file itself is not thread-safe, so only the futures it returns should be shared between threads.
+ */
+
+/*!
+ *  @class AsyncFile::Batch qx/io/qx-asyncfile.h
+ *
+ *  @brief The Batch class groups the operations of an AsyncFile so that they're submitted together.
+ *
+ *  While a batch exists, operations that are issued to its file are held back instead of being started
+ *  immediately, and then are all submitted at once when the batch is destroyed. With @c io_uring, this means
+ *  a batch is handed to the kernel with as few system calls as possible, rather than one per operation.
+ *
+ *  Batches can be nested, in which case operations are submitted when the outermost batch is destroyed.
+ *  Waiting for a file's operations to finish also submits any that are being held back.
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Creates a batch that holds back the operations of @a file until it's destroyed.
+ */
+AsyncFile::Batch::Batch(AsyncFile& file) :
+    mFile(file)
+{
+    if(mFile.mBatchDepth++ == 0 && mFile.mEngine)
+        mFile.mEngine->setDeferred(true);
+}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the batch, submitting the operations it held back unless it's nested within another batch.
+ */
+AsyncFile::Batch::~Batch()
+{
+    if(--mFile.mBatchDepth == 0 && mFile.mEngine)
+        mFile.mEngine->setDeferred(false);
+}
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs an async file that operates on the file with name @a fileName.
+ *
+ *  The file must be opened with open() before it can be read or written.
+ */
+AsyncFile::AsyncFile(const QString& fileName) :
+    mFile(fileName),
+    mBatchDepth(0)
+{}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the async file, after waiting for all of its operations to finish.
+ */
+AsyncFile::~AsyncFile() { close(); }
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Private:
+QFuture<IoOpReport> AsyncFile::enqueue(IoOpType type, std::byte* data, qint64 size, qint64 pos)
+{
+    if(!mEngine || pos < 0)
+    {
+        QPromise<IoOpReport> promise;
+        promise.start();
+        promise.addResult(IoOpReport(type, mEngine ? IO_ERR_CURSOR_OOB : IO_ERR_FILE_NOT_OPEN, mFile));
+        promise.finish();
+        return promise.future();
+    }
+
+    return mEngine->enqueue(type, data, size, pos);
+}
+
+//Public:
+/*!
+ *  Returns the name of the file the async file operates on.
+ */
+QString AsyncFile::fileName() const { return mFile.fileName(); }
+
+/*!
+ *  Returns @c true if the file is open; otherwise, returns @c false.
+ */
+bool AsyncFile::isOpen() const { return mEngine != nullptr; }
+
+/*!
+ *  Opens the file using @a openMode, which must include QIODevice::ReadOnly and/or QIODevice::WriteOnly.
+ *
+ *  Modes that depend on the file's position, such as QIODevice::Append, and QIODevice::Text aren't
+ *  meaningful for an async file since all of its operations have an explicit position and transfer bytes
+ *  verbatim. As with QFile, opening a file with only QIODevice::WriteOnly truncates it, so
+ *  QIODevice::ReadWrite should be used to modify part of an existing file. If the file is already open
+ *  it's closed first.
+ *
+ *  @return A report containing details of operation success or failure.
+ */
+IoOpReport AsyncFile::open(QIODevice::OpenMode openMode)
+{
+    close();
+
+    IoOpType opType = openMode.testFlag(QIODevice::WriteOnly) ? IO_OP_WRITE : IO_OP_READ;
+    IoOpResultType openResult = parsedOpen(&mFile, openMode | QIODevice::Unbuffered);
+    if(openResult != IO_SUCCESS)
+        return IoOpReport(opType, openResult, mFile);
+
+    QFileInfo target(mFile);
+    mEngine = createNativeAsyncFileEngine(mFile, target);
+    if(!mEngine)
+        mEngine = std::make_unique<ThreadPoolFileEngine>(mFile, target);
+
+    if(mBatchDepth > 0)
+        mEngine->setDeferred(true);
+
+    return IoOpReport(opType, IO_SUCCESS, mFile);
+}
+
+/*!
+ *  Closes the file, after waiting for all of its operations to finish.
+ *
+ *  Any buffers that were registered are unregistered.
+ */
+void AsyncFile::close()
+{
+    if(!mEngine)
+        return;
+
+    mEngine->waitForDone();
+    mEngine.reset();
+    mFile.close();
+}
+
+/*!
+ *  Registers @a buffers with the kernel so that operations that read into or write from memory that lies
+ *  entirely within one of them can skip mapping that memory each time, which reduces the overhead of
+ *  many small operations. Any buffers registered previously are replaced.
+ *
+ *  Registration is only an optimization, which is only possible with @c io_uring and is subject to the
+ *  limit on locked memory; operations behave the same regardless. The buffers must remain valid until they
+ *  are unregistered or the file is closed. This function waits for all outstanding operations to finish.
+ *
+ *  Returns @c true if the buffers were registered; otherwise, returns @c false.
+ *
+ *  @sa unregisterBuffers().
+ */
+bool AsyncFile::registerBuffers(const QList<std::span<std::byte>>& buffers)
+{
+    return mEngine ? mEngine->registerBuffers(buffers) : false;
+}
+
+/*!
+ *  Unregisters any buffers previously registered with registerBuffers(), after waiting for all outstanding
+ *  operations to finish.
+ */
+void AsyncFile::unregisterBuffers()
+{
+    if(mEngine)
+        mEngine->unregisterBuffers();
+}
+
+/*!
+ *  Starts reading bytes from the file at position @a pos to fill @a buffer, and returns a future through
+ *  which the outcome of the read can be accessed.
+ *
+ *  If the end of the file is reached before @a buffer is filled, the read fails with
+ *  IoOpResultType::IO_ERR_FILE_SIZE_MISMATCH, though the bytes that were available are still read.
+ */
+QFuture<IoOpReport> AsyncFile::read(std::span<std::byte> buffer, qint64 pos)
+{
+    return enqueue(IO_OP_READ, buffer.data(), buffer.size(), pos);
+}
+
+/*!
+ *  Starts writing @a data to the file at position @a pos, and returns a future through which the outcome
+ *  of the write can be accessed.
+ *
+ *  The file is extended if the data extends past its end.
+ */
+QFuture<IoOpReport> AsyncFile::write(std::span<const std::byte> data, qint64 pos)
+{
+    // Engines are shared by both directions, but never modify the data of a write
+    return enqueue(IO_OP_WRITE, const_cast<std::byte*>(data.data()), data.size(), pos);
+}
+
+/*!
+ *  Blocks until all operations that have been issued to the file have finished, submitting any that are
+ *  being held back by a Batch.
+ */
+void AsyncFile::waitForDone()
+{
+    if(mEngine)
+        mEngine->waitForDone();
+}
+
+}
@@ -0,0 +1,415 @@
+// Unit Includes
+#include "qx-asyncfile_p.h"
+
+// Standard Library Includes
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <vector>
+
+// Qt Includes
+#include <QSet>
+#include <QThread>
+
+// Intra-component Includes
+#include "qx-common-io_p.h"
+
+// System Includes
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+
+namespace Qx
+{
+/*! @cond */
+
+namespace
+{
+    // Submission queue size, which also limits how many operations are in flight at once
+    constexpr unsigned RING_ENTRIES = 256;
+
+    // Largest transfer made by a single request; anything longer is continued by further requests
+    constexpr qint64 MAX_REQUEST_SIZE = 1024 * 1024 * 1024;
+
+    // Marks the request that stops the completion thread
+    constexpr quint64 STOP_USER_DATA = 0;
+
+    int uringSetup(unsigned entries, io_uring_params* params) { return syscall(__NR_io_uring_setup, entries, params); }
+    int uringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+    {
+        return syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0);
+    }
+    int uringRegister(int fd, unsigned opcode, void* arg, unsigned args) { return syscall(__NR_io_uring_register, fd, opcode, arg, args); }
+
+    unsigned loadAcquire(unsigned* value) { return std::atomic_ref<unsigned>(*value).load(std::memory_order_acquire); }
+    void storeRelease(unsigned* value, unsigned v) { std::atomic_ref<unsigned>(*value).store(v, std::memory_order_release); }
+
+    class UringFileEngine : public AsyncFileEngine
+    {
+    private:
+        int mFd;
+        int mRingFd;
+        io_uring_params mParams;
+
+        // Ring mappings shared with the kernel
+        void* mSqRing;
+        size_t mSqRingSize;
+        void* mCqRing;
+        size_t mCqRingSize;
+        io_uring_sqe* mSqes;
+        unsigned* mSqTail;
+        unsigned* mSqMask;
+        unsigned* mSqArray;
+        unsigned* mCqHead;
+        unsigned* mCqTail;
+        unsigned* mCqMask;
+        io_uring_cqe* mCqes;
+
+        // Guarded by mMutex
+        QSet<AsyncFileOperation*> mInFlight; // Pushed to the ring and not yet completed
+        unsigned mUnsubmitted;
+        int mError; // Set once the ring can no longer be used
+        QList<std::span<std::byte>> mBuffers;
+
+        std::unique_ptr<QThread> mCompletionThread;
+
+    public:
+        UringFileEngine(int fd, const QFileInfo& target) :
+            AsyncFileEngine(target),
+            mFd(fd),
+            mRingFd(-1),
+            mParams{},
+            mSqRing(MAP_FAILED),
+            mSqRingSize(0),
+            mCqRing(MAP_FAILED),
+            mCqRingSize(0),
+            mSqes(static_cast<io_uring_sqe*>(MAP_FAILED)),
+            mUnsubmitted(0),
+            mError(0)
+        {}
+
+        ~UringFileEngine()
+        {
+            if(mCompletionThread)
+            {
+                waitForDone();
+
+                // The thread stops by itself after an error
+                if(!mCompletionThread->isFinished())
+                {
+                    io_uring_sqe stop{};
+                    stop.opcode = IORING_OP_NOP;
+                    stop.user_data = STOP_USER_DATA;
+
+                    mMutex.lock();
+                    pushRequest(stop);
+                    submit();
+                    mMutex.unlock();
+                }
+
+                mCompletionThread->wait();
+            }
+
+            if(mSqes != MAP_FAILED)
+                munmap(mSqes, mParams.sq_entries * sizeof(io_uring_sqe));
+            if(mCqRing != MAP_FAILED && mCqRing != mSqRing)
+                munmap(mCqRing, mCqRingSize);
+            if(mSqRing != MAP_FAILED)
+                munmap(mSqRing, mSqRingSize);
+            if(mRingFd != -1)
+                close(mRingFd);
+        }
+
+        bool setup()
+        {
+            mRingFd = uringSetup(RING_ENTRIES, &mParams);
+            if(mRingFd < 0)
+            {
+                mRingFd = -1;
+                return false; // Not supported or not permitted
+            }
+
+            // Plain read/write requests arrived alongside this feature (5.6)
+            if(!(mParams.features & IORING_FEAT_RW_CUR_POS))
+                return false;
+
+            // Map rings
+            mSqRingSize = mParams.sq_off.array + mParams.sq_entries * sizeof(unsigned);
+            mCqRingSize = mParams.cq_off.cqes + mParams.cq_entries * sizeof(io_uring_cqe);
+            bool singleMap = mParams.features & IORING_FEAT_SINGLE_MMAP;
+            if(singleMap)
+                mSqRingSize = mCqRingSize = std::max(mSqRingSize, mCqRingSize);
+
+            mSqRing = mmap(nullptr, mSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQ_RING);
+            if(mSqRing == MAP_FAILED)
+                return false;
+
+            mCqRing = singleMap ? mSqRing :
+                      mmap(nullptr, mCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_CQ_RING);
+            if(mCqRing == MAP_FAILED)
+                return false;
+
+            void* sqes = mmap(nullptr, mParams.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQES);
+            if(sqes == MAP_FAILED)
+                return false;
+            mSqes = static_cast<io_uring_sqe*>(sqes);
+
+            char* sq = static_cast<char*>(mSqRing);
+            mSqTail = reinterpret_cast<unsigned*>(sq + mParams.sq_off.tail);
+            mSqMask = reinterpret_cast<unsigned*>(sq + mParams.sq_off.ring_mask);
+            mSqArray = reinterpret_cast<unsigned*>(sq + mParams.sq_off.array);
+
+            char* cq = static_cast<char*>(mCqRing);
+            mCqHead = reinterpret_cast<unsigned*>(cq + mParams.cq_off.head);
+            mCqTail = reinterpret_cast<unsigned*>(cq + mParams.cq_off.tail);
+            mCqMask = reinterpret_cast<unsigned*>(cq + mParams.cq_off.ring_mask);
+            mCqes = reinterpret_cast<io_uring_cqe*>(cq + mParams.cq_off.cqes);
+
+            mCompletionThread.reset(QThread::create([this]{ reap(); }));
+            mCompletionThread->start();
+            return true;
+        }
+
+        bool registerBuffers(const QList<std::span<std::byte>>& buffers) override
+        {
+            // The kernel refuses to change registered buffers while they may be in use
+            waitForDone();
+            unregisterBuffers();
+
+            std::vector<iovec> vectors;
+            vectors.reserve(buffers.size());
+            for(const std::span<std::byte>& buffer : buffers)
+                vectors.push_back({buffer.data(), buffer.size()});
+
+            QMutexLocker locker(&mMutex);
+            if(uringRegister(mRingFd, IORING_REGISTER_BUFFERS, vectors.data(), vectors.size()) != 0)
+                return false;
+
+            mBuffers = buffers;
+            return true;
+        }
+
+        void unregisterBuffers() override
+        {
+            waitForDone();
+
+            QMutexLocker locker(&mMutex);
+            if(mBuffers.isEmpty())
+                return;
+
+            uringRegister(mRingFd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+            mBuffers.clear();
+        }
+
+    private:
+        int registeredBufferIndex(const AsyncFileOperation& op, qint64 size) const
+        {
+            for(qsizetype i = 0; i < mBuffers.size(); ++i)
+            {
+                const std::span<std::byte>& buffer = mBuffers[i];
+                if(op.data >= buffer.data() && op.data + size <= buffer.data() + buffer.size())
+                    return i;
+            }
+
+            return -1;
+        }
+
+        void pushRequest(const io_uring_sqe& request)
+        {
+            // Only called while a slot is free, the tail is only ever written here
+            unsigned tail = *mSqTail;
+            unsigned index = tail & *mSqMask;
+
+            mSqes[index] = request;
+            mSqArray[index] = index;
+            storeRelease(mSqTail, tail + 1);
+            ++mUnsubmitted;
+        }
+
+        void fail(AsyncFileOperation* op, int error)
+        {
+            mInFlight.remove(op);
+            mFailed.emplace_back(std::unique_ptr<AsyncFileOperation>(op), resultFromErrno(error, op->type));
+        }
+
+        void failRing(int error, bool includeSubmitted)
+        {
+            mError = error;
+
+            // Requests the kernel hasn't consumed yet can be taken back out of the ring
+            unsigned tail = *mSqTail;
+            for(unsigned i = tail - mUnsubmitted; i != tail; ++i)
+            {
+                quint64 userData = mSqes[i & *mSqMask].user_data;
+                if(userData != STOP_USER_DATA)
+                    fail(reinterpret_cast<AsyncFileOperation*>(userData), error);
+            }
+            storeRelease(mSqTail, tail - mUnsubmitted);
+            mUnsubmitted = 0;
+
+            // Submitted requests can only be abandoned if the ring is gone, as otherwise the kernel still completes them
+            if(includeSubmitted)
+            {
+                const QSet<AsyncFileOperation*> submitted = mInFlight;
+                for(AsyncFileOperation* op : submitted)
+                    fail(op, error);
+            }
+
+            while(!mQueued.empty())
+            {
+                fail(mQueued.front().release(), error);
+                mQueued.pop_front();
+            }
+        }
+
+        void submit()
+        {
+            while(mUnsubmitted != 0)
+            {
+                int submitted = uringEnter(mRingFd, mUnsubmitted, 0, 0);
+                if(submitted >= 0)
+                {
+                    mUnsubmitted -= submitted;
+                    continue;
+                }
+
+                if(errno == EINTR)
+                    continue;
+
+                /* The kernel is out of resources for new requests until some complete, so anything it didn't accept
+                 * stays in the ring and is resubmitted by the completion thread after it reaps completions. That
+                 * needs something to complete though, otherwise this is as much of a failure as any other error.
+                 */
+                if((errno == EAGAIN || errno == EBUSY) && mInFlight.size() > qsizetype(mUnsubmitted))
+                    return;
+
+                failRing(errno, false);
+                return;
+            }
+        }
+
+        void flush() override
+        {
+            // Nothing more can be submitted after an error
+            if(mError != 0)
+            {
+                failRing(mError, false);
+                return;
+            }
+
+            // Operations beyond the ring's capacity wait for earlier ones to complete
+            while(!mQueued.empty() && mInFlight.size() < qsizetype(mParams.sq_entries))
+            {
+                AsyncFileOperation* op = mQueued.front().release();
+                mQueued.pop_front();
+
+                qint64 size = std::min(op->size, MAX_REQUEST_SIZE);
+                int bufferIndex = registeredBufferIndex(*op, size);
+                bool read = op->type == IO_OP_READ;
+
+                io_uring_sqe request{};
+                request.opcode = bufferIndex != -1 ? (read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED) :
+                                                     (read ? IORING_OP_READ : IORING_OP_WRITE);
+                request.fd = mFd;
+                request.off = op->pos;
+                request.addr = reinterpret_cast<quint64>(op->data);
+                request.len = size;
+                request.buf_index = std::max(bufferIndex, 0);
+                request.user_data = reinterpret_cast<quint64>(op);
+
+                pushRequest(request);
+                mInFlight.insert(op);
+            }
+
+            submit();
+        }
+
+        void complete(AsyncFileOperation* completed, int res)
+        {
+            std::unique_ptr<AsyncFileOperation> op(completed);
+
+            QMutexLocker locker(&mMutex);
+            mInFlight.remove(op.get());
+
+            // Continue short transfers where they left off
+            if(res > 0 && res < op->size)
+            {
+                op->data += res;
+                op->pos += res;
+                op->size -= res;
+                mQueued.push_front(std::move(op));
+            }
+
+            if(!mDeferred && !mQueued.empty())
+                flush();
+            finishFailed(locker);
+
+            if(!op)
+                return;
+            locker.unlock();
+
+            IoOpResultType result = IO_SUCCESS;
+            if(res < 0)
+                result = resultFromErrno(-res, op->type);
+            else if(res == 0)
+                result = op->type == IO_OP_READ ? IO_ERR_FILE_SIZE_MISMATCH : IO_ERR_WRITE;
+
+            finish(std::move(op), result);
+        }
+
+        void reap()
+        {
+            for(bool running = true; running;)
+            {
+                /* An interrupted wait just means checking for completions early, while EBUSY and EAGAIN mean that
+                 * completions are already waiting. Anything else means the ring is unusable, so nothing that's
+                 * in flight will ever complete.
+                 */
+                if(uringEnter(mRingFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR && errno != EBUSY && errno != EAGAIN)
+                {
+                    QMutexLocker locker(&mMutex);
+                    failRing(errno, true);
+                    finishFailed(locker);
+                    return;
+                }
+
+                // Only this thread consumes completions
+                unsigned head = *mCqHead;
+                for(unsigned tail = loadAcquire(mCqTail); head != tail; ++head)
+                {
+                    const io_uring_cqe& cqe = mCqes[head & *mCqMask];
+                    if(cqe.user_data == STOP_USER_DATA)
+                        running = false;
+                    else
+                        complete(reinterpret_cast<AsyncFileOperation*>(cqe.user_data), cqe.res);
+                }
+                storeRelease(mCqHead, head);
+
+                // Resubmit anything the kernel turned away before these completions freed up resources
+                QMutexLocker locker(&mMutex);
+                if(mUnsubmitted != 0 && mError == 0)
+                    submit();
+                finishFailed(locker);
+
+                // After an error, stop once nothing is left to complete
+                if(mError != 0 && mInFlight.isEmpty())
+                    running = false;
+            }
+        }
+    };
+}
+
+std::unique_ptr<AsyncFileEngine> createNativeAsyncFileEngine(QFileDevice& file, const QFileInfo& target)
+{
+    auto engine = std::make_unique<UringFileEngine>(file.handle(), target);
+    if(!engine->setup())
+        return nullptr;
+
+    return engine;
+}
+
+/*! @endcond */
+}
@@ -0,0 +1,90 @@
+#ifndef QX_ASYNCFILE_P_H
+#define QX_ASYNCFILE_P_H
+
+// Standard Library Includes
+#include <deque>
+#include <memory>
+#include <span>
+#include <utility>
+
+// Qt Includes
+#include <QFileDevice>
+#include <QFileInfo>
+#include <QFuture>
+#include <QMutex>
+#include <QPromise>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+// Intra-component Includes
+#include "qx/io/qx-ioopreport.h"
+
+namespace Qx
+{
+/*! @cond */
+
+struct AsyncFileOperation
+{
+    IoOpType type;
+    std::byte* data;
+    qint64 size; // Remaining, after any partial transfers
+    qint64 pos;
+    QPromise<IoOpReport> promise;
+};
+
+// Carries out the operations of an open AsyncFile, which are dispatched in batches by flush()
+class AsyncFileEngine
+{
+    Q_DISABLE_COPY_MOVE(AsyncFileEngine);
+protected:
+    QFileInfo mTarget;
+    QMutex mMutex;
+    QWaitCondition mDone;
+    std::deque<std::unique_ptr<AsyncFileOperation>> mQueued; // Guarded by mMutex, as is everything below
+    std::deque<std::pair<std::unique_ptr<AsyncFileOperation>, IoOpResultType>> mFailed; // Failed by flush()
+    qint64 mOutstanding;
+    bool mDeferred;
+
+public:
+    explicit AsyncFileEngine(const QFileInfo& target);
+    virtual ~AsyncFileEngine() = default;
+
+protected:
+    // Called with mMutex locked to dispatch everything in mQueued, or as much as the engine can take
+    virtual void flush() = 0;
+    void finish(std::unique_ptr<AsyncFileOperation> op, IoOpResultType result);
+
+    // Called with mMutex locked, which is released while the operations in mFailed are finished
+    void finishFailed(QMutexLocker<QMutex>& locker);
+
+public:
+    QFuture<IoOpReport> enqueue(IoOpType type, std::byte* data, qint64 size, qint64 pos);
+    void setDeferred(bool deferred);
+    void waitForDone();
+
+    virtual bool registerBuffers(const QList<std::span<std::byte>>& buffers);
+    virtual void unregisterBuffers();
+};
+
+// Portable engine that performs each operation as a positional transfer on a thread pool
+class ThreadPoolFileEngine : public AsyncFileEngine
+{
+private:
+    QFileDevice& mFile;
+    QThreadPool mPool;
+
+public:
+    ThreadPoolFileEngine(QFileDevice& file, const QFileInfo& target);
+    ~ThreadPoolFileEngine();
+
+private:
+    void flush() override;
+};
+
+// Engine backed by the kernel's own asynchronous I/O facility, if available
+std::unique_ptr<AsyncFileEngine> createNativeAsyncFileEngine(QFileDevice& file, const QFileInfo& target);
+
+/*! @endcond */
+}
+
+#endif // QX_ASYNCFILE_P_H
@@ -0,0 +1,18 @@
+// Unit Includes
+#include "qx-asyncfile_p.h"
+
+namespace Qx
+{
+/*! @cond */
+
+std::unique_ptr<AsyncFileEngine> createNativeAsyncFileEngine(QFileDevice& file, const QFileInfo& target)
+{
+    /* Overlapped I/O requires the handle to be opened with FILE_FLAG_OVERLAPPED, which QFile doesn't allow
+     * control over, so the thread pool engine is used instead
+     */
+    Q_UNUSED(file); Q_UNUSED(target);
+    return nullptr;
+}
+
+/*! @endcond */
+}
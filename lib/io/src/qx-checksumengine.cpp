@@ -0,0 +1,267 @@
+// Unit Includes
+#include "qx/io/qx-checksumengine.h"
+
+// Standard Library Includes
+#include <new>
+
+// Qt Includes
+#include <QFile>
+#include <QFileInfo>
+
+// Intra-component Includes
+#include "qx-common-io_p.h"
+
+namespace
+{
+
+class ReadBuffer
+{
+    /* A page aligned buffer that's kept for the lifetime of each worker thread so that it doesn't need to be
+     * reallocated for every file
+     */
+private:
+    static constexpr std::align_val_t ALIGNMENT{4096};
+
+    char* mData = nullptr;
+    qsizetype mSize = 0;
+
+    void release()
+    {
+        if(mData)
+            ::operator delete(mData, ALIGNMENT);
+        mData = nullptr;
+        mSize = 0;
+    }
+
+public:
+    ReadBuffer() = default;
+    ReadBuffer(const ReadBuffer&) = delete;
+    ReadBuffer& operator=(const ReadBuffer&) = delete;
+    ~ReadBuffer() { release(); }
+
+    char* get(qsizetype size)
+    {
+        if(size > mSize)
+        {
+            release();
+            mData = static_cast<char*>(::operator new(size, ALIGNMENT));
+            mSize = size;
+        }
+
+        return mData;
+    }
+};
+
+}
+
+namespace Qx
+{
+
+//===============================================================================================================
+// ChecksumEngine::Result
+//===============================================================================================================
+
+/*!
+ *  @class ChecksumEngine::Result qx/io/qx-checksumengine.h
+ *
+ *  @brief The Result class holds the outcome of hashing a single file with a ChecksumEngine.
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Private:
+ChecksumEngine::Result::Result(const QString& filePath, const QString& checksum, const IoOpReport& report) :
+    mFilePath(filePath),
+    mChecksum(checksum),
+    mReport(report)
+{}
+
+//Public:
+/*!
+ *  Constructs a null result.
+ */
+ChecksumEngine::Result::Result() {}
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the path of the file that was hashed.
+ */
+QString ChecksumEngine::Result::filePath() const { return mFilePath; }
+
+/*!
+ *  Returns the checksum of the file as a hexadecimal string, or a null string if the file could not be hashed.
+ */
+QString ChecksumEngine::Result::checksum() const { return mChecksum; }
+
+/*!
+ *  Returns a report detailing the success or failure of reading the file.
+ */
+IoOpReport ChecksumEngine::Result::report() const { return mReport; }
+
+/*!
+ *  Returns @c true if the file could not be hashed; otherwise, returns @c false.
+ *
+ *  This is equivalent to <tt>report().isFailure()</tt>.
+ */
+bool ChecksumEngine::Result::isFailure() const { return mReport.isFailure(); }
+
+/*!
+ *  Returns @c true if the file was hashed successfully and its checksum matches @a checksum, ignoring case;
+ *  otherwise, returns @c false.
+ */
+bool ChecksumEngine::Result::matches(QStringView checksum) const
+{
+    return !isFailure() && QStringView(mChecksum).compare(checksum, Qt::CaseInsensitive) == 0;
+}
+
+//===============================================================================================================
+// ChecksumEngine
+//===============================================================================================================
+
+/*!
+ *  @class ChecksumEngine qx/io/qx-checksumengine.h
+ *  @ingroup qx-io
+ *
+ *  @brief The ChecksumEngine class calculates the checksums of many files concurrently.
+ *
+ *  A checksum engine hashes files on its own thread pool, the size of which bounds how many files are read
+ *  at once. Each file is read sequentially in large, page aligned chunks that are handed directly to the
+ *  hash function, and the operating system is advised of the sequential access pattern where supported so
+ *  that it can read ahead aggressively.
+ *
+ *  Results are delivered through a QFuture, with the result for each file being made available as soon as
+ *  that file has been hashed, at the same index as the file's path in the list that was provided. The result
+ *  of every file is reported, including those that could not be read. Using QFutureWatcher, results can be
+ *  handled as they arrive:
+ *
+ *  @code{.cpp}
+ *  Qx::ChecksumEngine engine(QCryptographicHash::Sha256);
+ *  QFuture<Qx::ChecksumEngine::Result> future = engine.hashFiles(installFiles);
+ *
+ *  auto watcher = new QFutureWatcher<Qx::ChecksumEngine::Result>(this);
+ *  connect(watcher, &QFutureWatcherBase::resultReadyAt, this, [=](int i){
+ *      Qx::ChecksumEngine::Result r = watcher->resultAt(i);
+ *      if(!r.matches(expectedChecksums.value(r.filePath())))
+ *          qWarning() << "Corrupt file:" << r.filePath();
+ *  });
+ *  watcher->setFuture(future);
+ *  @endcode
+ *
+ *  Canceling the future skips any files that have not yet been started.
+ *
+ *  @sa calculateFileChecksum() and fileMatchesChecksum().
+ */
+
+//-Class Variables--------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  @var qsizetype ChecksumEngine::DEFAULT_BUFFER_SIZE
+ *
+ *  The default size of the buffer each thread uses to read files.
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a checksum engine that hashes files using @a algorithm, with at most @a maxThreadCount
+ *  files being hashed at once.
+ */
+ChecksumEngine::ChecksumEngine(QCryptographicHash::Algorithm algorithm, int maxThreadCount) :
+    mAlgorithm(algorithm),
+    mBufferSize(DEFAULT_BUFFER_SIZE)
+{
+    setMaxThreadCount(maxThreadCount);
+}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the checksum engine, after waiting for all files that are being hashed to finish.
+ */
+ChecksumEngine::~ChecksumEngine() { mPool.waitForDone(); }
+
+//-Class Functions---------------------------------------------------------------------------------------------
+//Private:
+ChecksumEngine::Result ChecksumEngine::hashFile(const QString& filePath, QCryptographicHash::Algorithm algorithm, qsizetype bufferSize)
+{
+    QFile file(filePath);
+
+    // Check file
+    QFileInfo fileInfo(file);
+    IoOpResultType fileCheckResult = fileCheck(fileInfo, Existance::Exist);
+    if(fileCheckResult != IO_SUCCESS)
+        return Result(filePath, QString(), IoOpReport(IO_OP_READ, fileCheckResult, file));
+
+    // Attempt to open file, unbuffered since reads are already large
+    IoOpResultType openResult = parsedOpen(&file, QIODevice::ReadOnly | QIODevice::Unbuffered);
+    if(openResult != IO_SUCCESS)
+        return Result(filePath, QString(), IoOpReport(IO_OP_READ, openResult, file));
+
+    adviseSequentialRead(file);
+
+    // Hash
+    thread_local ReadBuffer buffer;
+    char* data = buffer.get(bufferSize);
+
+    QCryptographicHash checksumHash(algorithm);
+    for(qint64 read; (read = file.read(data, bufferSize)) != 0;)
+    {
+        if(read < 0)
+            return Result(filePath, QString(), IoOpReport(IO_OP_READ, IO_ERR_READ, file));
+
+        checksumHash.addData(QByteArrayView(data, read));
+    }
+
+    return Result(filePath, QString::fromLatin1(checksumHash.result().toHex()), IoOpReport(IO_OP_READ, IO_SUCCESS, file));
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the hash algorithm the engine uses.
+ */
+QCryptographicHash::Algorithm ChecksumEngine::algorithm() const { return mAlgorithm; }
+
+/*!
+ *  Returns the maximum number of files that are hashed at once.
+ */
+int ChecksumEngine::maxThreadCount() const { return mPool.maxThreadCount(); }
+
+/*!
+ *  Returns the size of the buffer each thread uses to read files.
+ */
+qsizetype ChecksumEngine::bufferSize() const { return mBufferSize; }
+
+/*!
+ *  Sets the maximum number of files that are hashed at once to @a maxThreadCount, which is raised
+ *  to @c 1 if it's lower.
+ */
+void ChecksumEngine::setMaxThreadCount(int maxThreadCount) { mPool.setMaxThreadCount(std::max(maxThreadCount, 1)); }
+
+/*!
+ *  Sets the size of the buffer each thread uses to read files to @a size, which is raised
+ *  to @c 4096 if it's lower.
+ *
+ *  This only affects files that are submitted afterwards.
+ */
+void ChecksumEngine::setBufferSize(qsizetype size) { mBufferSize = std::max(size, qsizetype(4096)); }
+
+/*!
+ *  Starts hashing each file in @a filePaths and returns a future through which the results can be accessed.
+ *
+ *  The result for the file at index @c i in @a filePaths is reported at index @c i of the future. The
+ *  future's progress value is the number of files that have been processed.
+ */
+QFuture<ChecksumEngine::Result> ChecksumEngine::hashFiles(const QStringList& filePaths)
+{
+    return processFiles<Result>(mPool, filePaths, [algorithm = mAlgorithm, bufferSize = mBufferSize](const QString& filePath){
+        return hashFile(filePath, algorithm, bufferSize);
+    });
+}
+
+/*!
+ *  Blocks until all files that have been submitted to the engine have been hashed.
+ */
+void ChecksumEngine::waitForDone() { mPool.waitForDone(); }
+
+}
@@ -2,14 +2,21 @@
 #include "qx/io/qx-common-io.h"
 #include "qx-common-io_p.h"
 
+// Standard Library Includes
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
 // Qt Includes
+#include <QBuffer>
 #include <QRegularExpression>
+#include <QStringConverter>
 
 // Intra-component Includes
+#include "qx/io/qx-directorycopier.h"
+#include "qx/io/qx-textfileindex.h"
 #include "qx/io/qx-textstream.h"
-
-// Extra-component Includes
-#include "qx/core/qx-char.h"
+#include "qx-textsearch_p.h"
 
 /*!
  *  @file qx-common-io.h
@@ -161,6 +168,67 @@ void matchAppendConditionParams(WriteMode& writeMode, TextPos& startPos)
         startPos = TextPos(End);
 }
 
+IoOpResultType insertFileRange(QFileDevice& file, qint64 pos, qint64 length)
+{
+    // Nothing follows the gap if it's at or past the end
+    qint64 size = file.size();
+    if(length <= 0 || pos >= size)
+        return IO_SUCCESS;
+
+    if(!file.flush())
+        return FILE_DEV_ERR_MAP.value(file.error());
+
+    if(nativeInsertFileRange(file, pos, length))
+        return IO_SUCCESS;
+
+    // Shift the tail back, starting from the end so that no data is overwritten before it's moved
+    QByteArray buffer(std::min(RANGE_SHIFT_BUFFER_SIZE, size - pos), Qt::Uninitialized);
+    for(qint64 end = size; end > pos;)
+    {
+        qint64 chunk = std::min(qint64(buffer.size()), end - pos);
+        qint64 src = end - chunk;
+
+        if(!file.seek(src) || file.read(buffer.data(), chunk) != chunk)
+            return IO_ERR_READ;
+        if(!file.seek(src + length) || file.write(buffer.constData(), chunk) != chunk)
+            return IO_ERR_WRITE;
+
+        end = src;
+    }
+
+    return IO_SUCCESS;
+}
+
+IoOpResultType removeFileRange(QFileDevice& file, qint64 pos, qint64 length)
+{
+    qint64 size = file.size();
+    length = std::min(length, size - pos);
+    if(length <= 0)
+        return IO_SUCCESS;
+
+    if(!file.flush())
+        return FILE_DEV_ERR_MAP.value(file.error());
+
+    if(nativeRemoveFileRange(file, pos, length))
+        return IO_SUCCESS;
+
+    // Shift the tail forward, starting from the beginning so that no data is overwritten before it's moved
+    QByteArray buffer(std::min(RANGE_SHIFT_BUFFER_SIZE, std::max(size - pos - length, qint64(1))), Qt::Uninitialized);
+    for(qint64 src = pos + length; src < size;)
+    {
+        qint64 chunk = std::min(qint64(buffer.size()), size - src);
+
+        if(!file.seek(src) || file.read(buffer.data(), chunk) != chunk)
+            return IO_ERR_READ;
+        if(!file.seek(src - length) || file.write(buffer.constData(), chunk) != chunk)
+            return IO_ERR_WRITE;
+
+        src += chunk;
+    }
+
+    return file.resize(size - length) ? IO_SUCCESS : FILE_DEV_ERR_MAP.value(file.error());
+}
+
 /*! @endcond */
 
 
@@ -575,6 +643,24 @@ IoOpReport textFileLineCount(int& returnBuffer, QFile& textFile, bool ignoreTrai
     return IoOpReport(IO_OP_ENUMERATE, TXT_STRM_STAT_MAP.value(fileTextStream.status()), textFile);
 }
 
+/*!
+ *  @overload
+ *
+ *  Determines the number of lines in @a textFile using @a index, without reading the file.
+ *
+ *  If @a index is not current for @a textFile, the file is read as usual.
+ *
+ *  @sa TextFileIndex::lineCount().
+ */
+IoOpReport textFileLineCount(int& returnBuffer, QFile& textFile, const TextFileIndex& index, bool ignoreTrailingEmpty)
+{
+    if(!index.isCurrent(textFile))
+        return textFileLineCount(returnBuffer, textFile, ignoreTrailingEmpty);
+
+    returnBuffer = index.lineCount(ignoreTrailingEmpty);
+    return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
+}
+
 /*!
  *  Converts any relative component of @a textPos to an absolute one. I.e. determines the actual line
  *  and or/character that Index32(Index32::Last) references for the given @a textFile, if present.
@@ -624,9 +710,57 @@ IoOpReport textFileAbsolutePosition(TextPos& textPos, QFile& textFile, bool igno
     return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
 }
 
+/*!
+ *  @overload
+ *
+ *  Converts any relative component of @a textPos to an absolute one using @a index, such that at most the
+ *  line that @a textPos refers to is read from @a textFile.
+ *
+ *  If @a index is not current for @a textFile, the whole file is read as usual.
+ *
+ *  @sa TextFileIndex.
+ */
+IoOpReport textFileAbsolutePosition(TextPos& textPos, QFile& textFile, const TextFileIndex& index, bool ignoreTrailingEmpty)
+{
+    if(!index.isCurrent(textFile))
+        return textFileAbsolutePosition(textPos, textFile, ignoreTrailingEmpty);
+
+    // Do nothing if position is null
+    if(textPos.isNull())
+        return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
+
+    // Translate line number, returning a null pos if the file is empty or the pos is OOB
+    int lineCount = index.lineCount(ignoreTrailingEmpty);
+    if(textPos.line().isLast())
+        textPos.setLine(lineCount - 1);
+
+    if(lineCount == 0 || textPos.line() >= lineCount)
+    {
+        textPos = TextPos();
+        return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
+    }
+
+    // Translate character number, which requires the length of the line
+    QStringList line;
+    IoOpReport lineRead = readTextFromFile(line, textFile, index, textPos.line(), textPos.line());
+    if(lineRead.isFailure())
+        return IoOpReport(IO_OP_ENUMERATE, lineRead.result(), textFile);
+
+    int lineLength = line.value(0).length();
+    if(textPos.character().isLast())
+        textPos.setCharacter(lineLength - 1);
+    else if(textPos.character() > lineLength)
+        textPos.setCharacter(lineLength); // Set to line end so that \n is still included
+
+    return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
+}
+
 /*!
  *  Searches for the given @a query within @a textFile and returns the result(s) if found.
  *
+ *  The file is memory mapped when possible and decoded as it's searched. Each hit begins after the end of
+ *  the previous one, so hits never overlap.
+ *
  *  @param[out] returnBuffer A List of positions where the query was found.
  *  @param[in] textFile The file search.
  *  @param[in] query The text to search for.
@@ -656,95 +790,31 @@ IoOpReport findStringInFile(QList<TextPos>& returnBuffer, QFile& textFile, const
     if(textFile.isOpen())
         textFile.close();
 
-    // Query tracking
-    TextPos trueStartPos = query.startPosition();
-    TextPos currentPos = TextPos(Start);
-    TextPos possibleMatch = TextPos();
-    int hitsSkipped = 0;
-    QString::const_iterator queryIt = query.string().constBegin();
-    QChar currentChar;
-
-    // Stream
-    QTextStream fileTextStream(&textFile);
-
-    // Translate start position to absolute position
-    if(trueStartPos != TextPos(Start))
-    {
-        IoOpReport translate = textFileAbsolutePosition(trueStartPos, textFile, readOptions.testFlag(IgnoreTrailingBreak));
-        if(translate.isFailure())
-            return IoOpReport(IO_OP_INSPECT, translate.result(), textFile);
-
-        // Return if position is outside bounds
-        if(trueStartPos.isNull())
-            return IoOpReport(IO_OP_INSPECT, translate.result(), textFile);
-    }
-
-    // Attempt to open file
-    IoOpResultType openResult = parsedOpen(&textFile, QIODevice::ReadOnly | QIODevice::Text);
+    // Attempt to open file, Text mode translation is handled by the search itself
+    IoOpResultType openResult = parsedOpen(&textFile, QIODevice::ReadOnly);
     if(openResult != IO_SUCCESS)
         return IoOpReport(IO_OP_INSPECT, openResult, textFile);
 
     // Ensure file is closed upon return
     QScopeGuard fileGuard([&textFile](){ textFile.close(); });
 
-    // Skip to start pos
-    if(trueStartPos != TextPos(Start))
-    {
-        int line;
-        // Skip to start line
-        for(line = 0; line != trueStartPos.line(); ++line)
-            fileTextStream.readLineInto(nullptr);
-
-        // Skip to start character
-        int c;
-        for(c = 0; c != trueStartPos.character(); ++c)
-            fileTextStream.read(1);
-
-        currentPos = trueStartPos;
-    }
-
     // Search for query
-    while(!fileTextStream.atEnd())
-    {
-        fileTextStream >> currentChar;
+    FileBytes fileBytes(textFile);
+    if(fileBytes.hasError())
+        return IoOpReport(IO_OP_INSPECT, IO_ERR_READ, textFile);
 
-        if(Char::compare(currentChar, *queryIt, query.caseSensitivity()) == 0)
-        {
-            if(possibleMatch.isNull())
-                possibleMatch = currentPos;
-            ++queryIt;
-        }
-        else if(!(currentChar == ENDL && query.allowSplit()))
-        {
-            possibleMatch = TextPos();
-            queryIt = query.string().constBegin();
-        }
-
-        if(queryIt == query.string().constEnd())
-        {
-            if(hitsSkipped == query.hitsToSkip())
-                returnBuffer.append(possibleMatch);
-            else
-                ++hitsSkipped;
-
-            if(returnBuffer.size() == query.hitLimit())
-                return IoOpReport(IO_OP_INSPECT, TXT_STRM_STAT_MAP.value(fileTextStream.status()), textFile);
+    // Translate start position to absolute position using the contents that are already in memory
+    TextPos trueStartPos = query.startPosition();
+    textAbsolutePosition(trueStartPos, fileBytes.data(), readOptions.testFlag(IgnoreTrailingBreak));
 
-            possibleMatch = TextPos();
-            queryIt = query.string().constBegin();
-        }
+    // Return if position is outside bounds
+    if(trueStartPos.isNull())
+        return IoOpReport(IO_OP_INSPECT, IO_SUCCESS, textFile);
 
-        if(currentChar == ENDL)
-        {
-            currentPos.setLine(currentPos.line() + 1);
-            currentPos.setCharacter(0);
-        }
-        else
-            currentPos.setCharacter(currentPos.character() + 1);
-    }
+    returnBuffer = findStringInText(fileBytes.data(), query, trueStartPos);
 
     // Return status
-    return IoOpReport(IO_OP_INSPECT, TXT_STRM_STAT_MAP.value(fileTextStream.status()), textFile);
+    return IoOpReport(IO_OP_INSPECT, IO_SUCCESS, textFile);
 }
 
 /*!
@@ -1110,15 +1180,342 @@ IoOpReport readTextFromFile(QStringList& returnBuffer, QFile& textFile, Index32
      }
 }
 
+/*!
+ *  @overload
+ *
+ *  Reads the given range of lines from @a textFile, using @a index to go directly to @a startLine
+ *  instead of reading every line that precedes it.
+ *
+ *  If @a index is not current for @a textFile, the file is read from its start as usual.
+ *
+ *  @param[out] returnBuffer The text read from the file, separated by line.
+ *  @param[in] textFile The file to read from.
+ *  @param[in] index An index of the file.
+ *  @param[in] startLine The line to begin reading from.
+ *  @param[in] endLine The line to read until.
+ *  @param[in] readOptions Options modifying how the file is parsed.
+ *  @return A report containing details of operation success or failure.
+ *
+ *  @note The output list will not contain any end-of-line characters.
+ *
+ *  @sa TextFileIndex.
+ */
+IoOpReport readTextFromFile(QStringList& returnBuffer, QFile& textFile, const TextFileIndex& index, Index32 startLine, Index32 endLine,
+                            ReadOptions readOptions)
+{
+    if(!index.isCurrent(textFile))
+        return readTextFromFile(returnBuffer, textFile, startLine, endLine, readOptions);
+
+    // Ensure positions are valid
+    if(startLine.isNull() || endLine.isNull())
+        qFatal("The start and end lines cannot be null!");
+    else if(startLine > endLine)
+        qFatal("endLine must be greater than or equal to startLine for Qx::readTextFromFile()");
+
+    // Empty buffer
+    returnBuffer = QStringList();
+
+    // Close file if it's already open
+    if(textFile.isOpen())
+        textFile.close();
+
+    // Translate line range
+    int lineCount = index.lineCount(readOptions.testFlag(IgnoreTrailingBreak));
+    int firstLine = startLine.isLast() ? lineCount - 1 : *startLine;
+    int lastLine = endLine.isLast() ? lineCount - 1 : std::min(*endLine, lineCount - 1);
+
+    // Return null list if the range is outside the file
+    if(firstLine < 0 || firstLine >= lineCount)
+        return IoOpReport(IO_OP_READ, IO_SUCCESS, textFile);
+
+    // Attempt to open file
+    IoOpResultType openResult = parsedOpen(&textFile, QIODevice::ReadOnly | QIODevice::Text);
+    if(openResult != IO_SUCCESS)
+        return IoOpReport(IO_OP_READ, openResult, textFile);
+
+    // Ensure file is closed upon return
+    QScopeGuard fileGuard([&textFile](){ textFile.close(); });
+
+    TextStream fileTextStream(&textFile);
+    if(!fileTextStream.seek(index.lineOffset(firstLine)))
+        return IoOpReport(IO_OP_READ, IO_ERR_REPOSITION, textFile);
+
+    // Read lines, the last of which may be the empty line that follows a trailing break
+    for(int line = firstLine; line <= lastLine; ++line)
+        returnBuffer.append(fileTextStream.atEnd() ? u""_s : fileTextStream.readLine());
+
+    // Return stream status
+    return IoOpReport(IO_OP_READ, TXT_STRM_STAT_MAP.value(fileTextStream.status()), textFile);
+}
+
 namespace
 {
+    struct TextLocation
+    {
+        int line;
+        qint64 lineStart;
+        qint64 start; // Offset of the character
+        qint64 end; // Offset following the character
+        bool exists; // False if the position is past the end of its line or the file
+    };
+
+    /* Finds text positions within ASCII compatible files in terms of byte offsets, reading no more than
+     * a small buffer at a time. Like when a file is read in text mode, carriage returns are ignored.
+     */
+    class TextLocator
+    {
+    //-Class Variables-----------------------------------------------------------------------------------------------
+    private:
+        static constexpr qint64 BUFFER_SIZE = 64 * 1024;
+
+    //-Instance Variables--------------------------------------------------------------------------------------------
+    private:
+        QFileDevice& mFile;
+        QByteArray mBuffer;
+        qint64 mBufferPos;
+        qsizetype mIndex;
+        qint64 mTextStart;
+        bool mSupported;
+        bool mError;
+
+    //-Constructor---------------------------------------------------------------------------------------------------
+    public:
+        TextLocator(QFileDevice& file) :
+            mFile(file),
+            mBufferPos(0),
+            mIndex(0),
+            mTextStart(0),
+            mSupported(false),
+            mError(false)
+        {
+            seek(0);
+            if(mError)
+                return;
+
+            auto encoding = QStringConverter::encodingForData(mBuffer);
+            mSupported = !encoding || *encoding == QStringConverter::Utf8;
+            if(encoding)
+                mTextStart = 3; // Skip BOM
+        }
+
+    //-Instance Functions--------------------------------------------------------------------------------------------
+    private:
+        void seek(qint64 pos)
+        {
+            mBufferPos = pos;
+            mIndex = 0;
+            mBuffer.resize(BUFFER_SIZE);
+            qint64 read = mFile.seek(pos) ? mFile.read(mBuffer.data(), BUFFER_SIZE) : -1;
+            mError = mError || read < 0;
+            mBuffer.resize(std::max(read, qint64(0)));
+        }
+
+        qint64 offset() const { return mBufferPos + mIndex; }
+
+        int peek()
+        {
+            if(mIndex == mBuffer.size())
+            {
+                if(mBuffer.isEmpty())
+                    return -1;
+                seek(offset());
+                if(mBuffer.isEmpty())
+                    return -1;
+            }
+
+            return static_cast<uchar>(mBuffer.at(mIndex));
+        }
+
+        bool skipLine()
+        {
+            while(peek() != -1)
+            {
+                const char* data = mBuffer.constData() + mIndex;
+                auto lf = static_cast<const char*>(std::memchr(data, '\n', mBuffer.size() - mIndex));
+                if(lf)
+                {
+                    mIndex += lf - data + 1;
+                    return true;
+                }
+                mIndex = mBuffer.size();
+            }
+
+            return false;
+        }
+
+    public:
+        bool isSupported() const { return mSupported; }
+        bool hasError() const { return mError; }
+
+        TextLocation locate(const TextPos& pos, const TextLocation* from = nullptr)
+        {
+            // Start from the beginning or a previous location at or before the desired line
+            TextLocation location{.line = 0, .lineStart = mTextStart, .start = 0, .end = 0, .exists = true};
+            if(from)
+            {
+                location.line = from->line;
+                location.lineStart = from->lineStart;
+            }
+            seek(location.lineStart);
+
+            // Find line
+            if(pos.line().isLast())
+            {
+                while(skipLine())
+                {
+                    location.line++;
+                    location.lineStart = offset();
+                }
+                seek(location.lineStart);
+            }
+            else
+            {
+                for(; location.line < *pos.line(); location.line++)
+                {
+                    if(!skipLine())
+                    {
+                        location.start = location.end = offset();
+                        location.exists = false;
+                        return location;
+                    }
+                    location.lineStart = offset();
+                }
+            }
+
+            // Find character, counting in UTF-16 code units like QString
+            qint64 units = 0;
+            qint64 lastStart = location.lineStart;
+            qint64 lastEnd = location.lineStart;
+            for(int b; (b = peek()) != -1 && b != '\n';)
+            {
+                if(b == '\r')
+                {
+                    mIndex++;
+                    continue;
+                }
+
+                qint64 charStart = offset();
+                for(mIndex++; (peek() & 0xC0) == 0x80; mIndex++) {} // Skip continuation bytes
+
+                if(!pos.character().isLast() && units >= *pos.character())
+                {
+                    location.start = charStart;
+                    location.end = offset();
+                    return location;
+                }
+
+                units += b >= 0xF0 ? 2 : 1;
+                lastStart = charStart;
+                lastEnd = offset();
+            }
+
+            // Last character, or the end of the line
+            location.start = pos.character().isLast() ? lastStart : lastEnd;
+            location.end = lastEnd;
+            location.exists = pos.character().isLast() || *pos.character() == units;
+            return location;
+        }
+    };
+
+    std::optional<IoOpReport> insertStringInPlace(QFileDevice& textFile, const QString& text, const TextPos& startPos, const WriteOptions& writeOptions)
+    {
+        // Attempt to open file
+        IoOpResultType openResult = parsedOpen(&textFile, QIODevice::ReadWrite | QIODevice::Unbuffered);
+        if(openResult != IO_SUCCESS)
+            return IoOpReport(IO_OP_WRITE, openResult, textFile);
+
+        // Ensure file is closed upon return
+        QScopeGuard fileGuard([&textFile](){ textFile.close(); });
+
+        // Find insertion point, leaving unsupported encodings and padding to a full rewrite
+        TextLocator locator(textFile);
+        if(!locator.hasError() && !locator.isSupported())
+            return std::nullopt;
+
+        TextLocation location = locator.locate(startPos);
+        if(locator.hasError())
+            return IoOpReport(IO_OP_WRITE, IO_ERR_READ, textFile);
+        if(!location.exists && writeOptions.testFlag(Pad))
+            return std::nullopt;
+
+        // Encode text exactly as a text stream would write it to the file
+        QByteArray encoded;
+        {
+            QBuffer encodeBuffer(&encoded);
+            encodeBuffer.open(QIODevice::WriteOnly | QIODevice::Text);
+            QTextStream encodeStream(&encodeBuffer);
+            if(writeOptions.testFlag(EnsureBreak) && location.start != location.lineStart)
+                encodeStream << ENDL;
+            encodeStream << text;
+        }
+
+        // Make room for and write text
+        IoOpResultType shiftResult = insertFileRange(textFile, location.start, encoded.size());
+        if(shiftResult != IO_SUCCESS)
+            return IoOpReport(IO_OP_WRITE, shiftResult, textFile);
+
+        if(!textFile.seek(location.start) || textFile.write(encoded) != encoded.size())
+            return IoOpReport(IO_OP_WRITE, IO_ERR_WRITE, textFile);
+
+        return IoOpReport(IO_OP_WRITE, FILE_DEV_ERR_MAP.value(textFile.error()), textFile);
+    }
+
+    std::optional<IoOpReport> deleteTextInPlace(QFile& textFile, const TextPos& startPos, const TextPos& endPos)
+    {
+        // Attempt to open file
+        IoOpResultType openResult = parsedOpen(&textFile, QIODevice::ReadWrite | QIODevice::Unbuffered);
+        if(openResult != IO_SUCCESS)
+            return IoOpReport(IO_OP_WRITE, openResult, textFile);
+
+        // Ensure file is closed upon return
+        QScopeGuard fileGuard([&textFile](){ textFile.close(); });
+
+        // Find range, leaving unsupported encodings to a full rewrite
+        TextLocator locator(textFile);
+        if(!locator.hasError() && !locator.isSupported())
+            return std::nullopt;
+
+        TextLocation start = locator.locate(startPos);
+        TextLocation end = locator.locate(endPos, &start);
+        if(locator.hasError())
+            return IoOpReport(IO_OP_WRITE, IO_ERR_READ, textFile);
+
+        /* Removing a range that spans lines also removes the breaks between them, so like with a full rewrite, the
+         * text that remains on either side must be kept on separate lines
+         */
+        QByteArray lineBreak;
+        if(end.line > start.line && start.start > start.lineStart)
+        {
+            char next;
+            if(!textFile.seek(end.end))
+                return IoOpReport(IO_OP_WRITE, IO_ERR_READ, textFile);
+            if(textFile.getChar(&next) && next != '\n' && next != '\r')
+            {
+                // Encode the break exactly as a text stream would write it to the file
+                QBuffer encodeBuffer(&lineBreak);
+                encodeBuffer.open(QIODevice::WriteOnly | QIODevice::Text);
+                QTextStream(&encodeBuffer) << ENDL;
+            }
+        }
+
+        // Remove range, leaving room for the break if needed
+        qint64 removed = end.end - start.start;
+        IoOpResultType resizeResult = removed >= lineBreak.size() ?
+                                      removeFileRange(textFile, start.start, removed - lineBreak.size()) :
+                                      insertFileRange(textFile, start.start, lineBreak.size() - removed);
+        if(resizeResult != IO_SUCCESS || lineBreak.isEmpty())
+            return IoOpReport(IO_OP_WRITE, resizeResult, textFile);
+
+        if(!textFile.seek(start.start) || textFile.write(lineBreak) != lineBreak.size())
+            return IoOpReport(IO_OP_WRITE, IO_ERR_WRITE, textFile);
+
+        return IoOpReport(IO_OP_WRITE, FILE_DEV_ERR_MAP.value(textFile.error()), textFile);
+    }
+
     IoOpReport pWriteStringToFile(QFileDevice* textFile, const QString& text, WriteMode& writeMode, TextPos& startPos, const WriteOptions& writeOptions)
     {
-        /* TODO: Memory usage can be improved for inserts/overwrites by reading lines until at target lines, then reading characters
-         * one by one until at target char - 1 and noting the position. Then like normal read in the afterText, then return to the
-         * marked position and just start writing from there. The file may need to be truncated first depending on QTextStream's behavior
-         * (it seems it may default to writing to end regardless of where read cursor was) and special handling would be required for when
-         * a LF is discovered before the target char - 1 point is reached. This may also work for things like text deletion
+        /* TODO: Memory usage can be improved for overwrites in the same way as inserts, by locating the start position and the end
+         * of the overwritten text with TextLocator and then resizing the range between them in place before writing the new text
          */
 
         // Ensure position is valid
@@ -1137,6 +1534,14 @@ namespace
         if(prepResult.isFailure())
             return prepResult;
 
+        // Insert without rewriting the whole file if possible (save files always start empty so they need the full rewrite)
+        if(writeMode == Insert && fileInfo.exists() && qobject_cast<QFile*>(textFile))
+        {
+            std::optional<IoOpReport> insertResult = insertStringInPlace(*textFile, text, startPos, writeOptions);
+            if(insertResult)
+                return *insertResult;
+        }
+
         // Construct TextStream
         QTextStream textStream(textFile);
 
@@ -1294,6 +1699,9 @@ namespace
 /*!
  *  Writes the given text to @a textFile.
  *
+ *  When inserting into a file that uses an ASCII compatible encoding, such as UTF-8, only the data that follows
+ *  @a startPos is moved, in place, unless padding is required.
+ *
  *  @param[in] textFile The file to write to.
  *  @param[in] text The text to be written.
  *  @param[in] writeMode The mode to use for writing.
@@ -1343,6 +1751,13 @@ IoOpReport writeStringToFile(QSaveFile& textFile, const QString& text, WriteMode
 /*!
  *  Removes the given range of text from @a textFile.
  *
+ *  If the file uses an ASCII compatible encoding, such as UTF-8, only the data that follows the range is moved,
+ *  in place, instead of the whole file being rewritten.
+ *
+ *  Line breaks within the range are removed along with it, except that if the range spans more than one line
+ *  and text remains both before it on its first line and after it on its last line, a single line break is
+ *  written in its place so that the two remain on separate lines.
+ *
  *  @param[in] textFile The file from which text is to be removed.
  *  @param[in] startPos The first character to be removed.
  *  @param[in] endPos The last character to be removed.
@@ -1369,6 +1784,11 @@ IoOpReport deleteTextFromFile(QFile& textFile, TextPos startPos, TextPos endPos)
     if(textFile.isOpen())
         textFile.close();
 
+    // Remove text without rewriting the whole file if possible
+    std::optional<IoOpReport> inPlaceResult = deleteTextInPlace(textFile, startPos, endPos);
+    if(inPlaceResult)
+        return *inPlaceResult;
+
     // Text to keep
     QString beforeDeletion;
     QString afterDeletion;
@@ -1435,8 +1855,18 @@ IoOpReport deleteTextFromFile(QFile& textFile, TextPos startPos, TextPos endPos)
  */
 bool dirContainsFiles(const QDir& directory, QDirIterator::IteratorFlags iteratorFlags)
 {
+    const QDir::Filters filters = QDir::Files | QDir::NoDotAndDotDot;
+
+    // Stop at the first file
+    bool containsFiles = false;
+    if(nativeDirEntries(directory.path(), {}, filters, iteratorFlags, [&containsFiles](const DirEntry&){
+        containsFiles = true;
+        return false;
+    }))
+        return containsFiles;
+
     // Construct directory iterator
-    QDirIterator listIterator(directory.path(), QDir::Files | QDir::NoDotAndDotDot, iteratorFlags);
+    QDirIterator listIterator(directory.path(), filters, iteratorFlags);
 
     return listIterator.hasNext();
 }
@@ -1496,6 +1926,13 @@ IoOpReport dirContentInfoList(QFileInfoList& returnBuffer, const QDir& directory
         return IoOpReport(IO_OP_ENUMERATE, dirCheckResult, directory);
 
 
+    // Use the fast path if possible
+    if(nativeDirEntries(directory.path(), nameFilters, filters, flags, [&returnBuffer](const DirEntry& entry){
+        returnBuffer.append(entry.fileInfo());
+        return true;
+    }))
+        return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, directory);
+
     // Construct directory iterator
     QDirIterator listIterator(directory.path(), nameFilters, filters, flags);
 
@@ -1508,6 +1945,63 @@ IoOpReport dirContentInfoList(QFileInfoList& returnBuffer, const QDir& directory
     return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, directory);
 }
 
+/*!
+ *  Fills @a returnBuffer with a list of lightweight entries for all the files and directories in @a directory, limited
+ *  according to the name and attribute filters previously set with QDir::setNameFilters() and QDir::setFilter(), while sort
+ *  flags are ignored.
+ *
+ *  The name filter and file attribute filter can be overridden using the @a nameFilters and @a filters arguments respectively.
+ *
+ *  Directory traversal rules can be further refined via @a iteratorFlags.
+ *
+ *  This produces the same entries as dirContentInfoList(), but is considerably faster for large directories since only
+ *  the path and type of each entry are determined. On Linux, directories are read in large batches directly from the
+ *  kernel and entries are filtered without retrieving any further metadata, except for symbolic links, as long as
+ *  the filters don't include only some of the permission flags and @a iteratorFlags doesn't include
+ *  QDirIterator::FollowSymlinks. Name filters that use character sets, or that contain non-ASCII characters when
+ *  filtering without case sensitivity, also require the slower path.
+ *
+ *  Returns a report containing details of operation success or failure.
+ *
+ *  @sa DirEntry.
+ */
+IoOpReport dirContentEntryList(QList<DirEntry>& returnBuffer, const QDir& directory, QStringList nameFilters,
+                               QDir::Filters filters, QDirIterator::IteratorFlags flags)
+{
+    // Empty buffer
+    returnBuffer = QList<DirEntry>();
+
+    // Handle overrides
+    if(nameFilters.isEmpty())
+        nameFilters = directory.nameFilters();
+    if(filters == QDir::NoFilter)
+        filters = directory.filter();
+
+    // Check directory
+    QFileInfo dirInfo(directory.path());
+    IoOpResultType dirCheckResult = directoryCheck(dirInfo);
+    if(dirCheckResult != IO_SUCCESS)
+        return IoOpReport(IO_OP_ENUMERATE, dirCheckResult, directory);
+
+    // Use the fast path if possible
+    if(nativeDirEntries(directory.path(), nameFilters, filters, flags, [&returnBuffer](const DirEntry& entry){
+        returnBuffer.append(entry);
+        return true;
+    }))
+        return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, directory);
+
+    // Construct directory iterator
+    QDirIterator listIterator(directory.path(), nameFilters, filters, flags);
+
+    while(listIterator.hasNext())
+    {
+        listIterator.next();
+        returnBuffer.append(DirEntry(listIterator.fileInfo()));
+    }
+
+    return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, directory);
+}
+
 /*!
  *  Fills @a returnBuffer with a list of names for all the files and directories in @a directory, limited according
  *  to the name and attribute filters previously set with QDir::setNameFilters() and QDir::setFilter(), while sort flags are ignored.
@@ -1540,6 +2034,13 @@ IoOpReport dirContentList(QStringList& returnBuffer, const QDir& directory, QStr
         return IoOpReport(IO_OP_ENUMERATE, dirCheckResult, directory);
 
 
+    // Use the fast path if possible
+    if(nativeDirEntries(directory.path(), nameFilters, filters, flags, [&](const DirEntry& entry){
+        returnBuffer.append(pathType == PathType::Absolute ? entry.path() : directory.relativeFilePath(entry.path()));
+        return true;
+    }))
+        return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, directory);
+
     // Construct directory iterator
     QDirIterator listIterator(directory.path(), nameFilters, filters, flags);
 
@@ -1552,48 +2053,25 @@ IoOpReport dirContentList(QStringList& returnBuffer, const QDir& directory, QStr
     return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, directory);
 }
 
+namespace
+{
+    // Shared by all calls to copyDirectory() so that each doesn't have to create and tear down its own threads
+    Q_GLOBAL_STATIC(DirectoryCopier, sharedDirectoryCopier);
+}
+
 /*!
- *  Copies @a directory to @a destination, recursively if @a recursive is @c true. Existing files are overwritten if
- *  @a overwrite is @c true.
+ *  Copies @a directory to @a destination, recursively if @a recursive is @c true. Existing files are handled
+ *  according to @a replaceMode.
+ *
+ *  Files are copied concurrently using a DirectoryCopier with its default number of threads that is shared by
+ *  all calls to this function, and this function blocks until the copy is finished. Use a DirectoryCopier
+ *  directly to copy asynchronously and track progress.
+ *
+ *  @sa DirectoryCopier.
  */
 IoOpReport copyDirectory(const QDir& directory, const QDir& destination, bool recursive, ReplaceMode replaceMode)
 {
-    // Ensure destination exists
-    if(!destination.mkpath(u"."_s))
-        return IoOpReport(IO_OP_WRITE, IO_ERR_CANT_CREATE, destination);
-
-    QDirIterator srcItr(directory.path(), QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs, recursive ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags);
-    while(srcItr.hasNext())
-    {
-        srcItr.next();
-        QFileInfo fi = srcItr.fileInfo();
-
-        QString subPath = fi.absoluteFilePath().mid(directory.absolutePath().length() + 1); // Drop last '/'
-        QString absDestPath = destination.absoluteFilePath(subPath);
-
-        if(fi.isDir())
-        {
-            if(!destination.mkpath(subPath))
-                return IoOpReport(IO_OP_WRITE, IO_ERR_CANT_CREATE, QDir(absDestPath));
-        }
-        else if(fi.isFile())
-        {
-            if(QFile::exists(absDestPath))
-            {
-                if(replaceMode == ReplaceMode::Skip)
-                    continue;
-                else if(replaceMode == ReplaceMode::Stop)
-                    return IoOpReport(IO_OP_WRITE, IO_ERR_EXISTS, QFile(absDestPath));
-                else if(!QFile::remove(absDestPath))
-                    return IoOpReport(IO_OP_WRITE, IO_ERR_REMOVE, QFile(absDestPath));
-            }
-
-            if(!QFile::copy(fi.absoluteFilePath(), absDestPath))
-                return IoOpReport(IO_OP_WRITE, IO_ERR_COPY, QFile(absDestPath));
-        }
-    }
-
-    return IoOpReport(IO_OP_WRITE, IO_SUCCESS, destination);
+    return sharedDirectoryCopier->copy(directory, destination, recursive, replaceMode).result();
 }
 
 /*!
@@ -1742,6 +2220,123 @@ IoOpReport readBytesFromFile(QByteArray& returnBuffer, QFile& file, Index64 star
     return IoOpReport(IO_OP_READ, IO_SUCCESS, file);
 }
 
+/*!
+ *  @overload
+ *
+ *  Reads bytes from @a file into @a returnBuffer, without allocating any memory.
+ *
+ *  Unlike the other overload, if @a file is already open it's used as is and is left open, which avoids
+ *  reopening the file when many reads are made from it, such as when accessing records in a large pack file.
+ *  The read is made at an explicit position, so the file's current position is unaffected.
+ *
+ *  @param[out] returnBuffer The buffer to fill with bytes from the file.
+ *  @param[out] bytesRead The number of bytes read, which is less than the size of @a returnBuffer only if the
+ *  end of the file is reached.
+ *  @param[in] file The file to read from.
+ *  @param[in] startPos The position to begin reading from.
+ *  @return A report containing details of operation success or failure.
+ */
+IoOpReport readBytesFromFile(std::span<std::byte> returnBuffer, qint64& bytesRead, QFile& file, Index64 startPos)
+{
+    // Ensure position is valid
+    if(startPos.isNull())
+        qFatal("The start position cannot be null!");
+
+    // Reset count
+    bytesRead = 0;
+
+    // Open file if it isn't already, and ensure it's only closed upon return in that case
+    bool wasOpen = file.isOpen();
+    if(!wasOpen)
+    {
+        QFileInfo fileInfo(file);
+        IoOpResultType fileCheckResult = fileCheck(fileInfo, Existance::Exist);
+        if(fileCheckResult != IO_SUCCESS)
+            return IoOpReport(IO_OP_READ, fileCheckResult, file);
+
+        IoOpResultType openResult = parsedOpen(&file, QIODevice::ReadOnly | QIODevice::Unbuffered);
+        if(openResult != IO_SUCCESS)
+            return IoOpReport(IO_OP_READ, openResult, file);
+    }
+    else if(file.isWritable() && !file.flush()) // Buffered writes would otherwise be missed
+        return IoOpReport(IO_OP_READ, FILE_DEV_ERR_MAP.value(file.error()), file);
+
+    QScopeGuard fileGuard([&file, wasOpen](){ if(!wasOpen) file.close(); });
+
+    // Read data
+    qint64 pos = startPos.isLast() ? std::max(file.size() - 1, qint64(0)) : *startPos;
+    return IoOpReport(IO_OP_READ, nativeReadAt(file, pos, returnBuffer, bytesRead), file);
+}
+
+/*!
+ *  Maps the given range of bytes from @a file into memory, providing read-only access to them without
+ *  reading them into a buffer.
+ *
+ *  If @a file is already open it's used as is and is left open; otherwise, it's opened for the mapping to
+ *  be created and then closed, which doesn't affect the mapping. Either way, @a file must outlive the
+ *  mapping.
+ *
+ *  @param[out] returnBuffer The mapped bytes, which is null if the range is empty.
+ *  @param[in] file The file to map.
+ *  @param[in] startPos The position to begin mapping from.
+ *  @param[in] endPos The position to map until.
+ *  @return A report containing details of operation success or failure.
+ *
+ *  @sa FileMapping.
+ */
+IoOpReport mapBytesFromFile(FileMapping& returnBuffer, QFile& file, Index64 startPos, Index64 endPos)
+{
+    // Ensure positions are valid
+    if(startPos.isNull() || endPos.isNull())
+        qFatal("The start and end positions cannot be null!");
+    else if(startPos > endPos)
+        qFatal("endPos must be greater than or equal to startPos for Qx::mapBytesFromFile()");
+
+    // Reset return buffer
+    returnBuffer = FileMapping();
+
+    // Open file if it isn't already, and ensure it's only closed upon return in that case
+    bool wasOpen = file.isOpen();
+    if(!wasOpen)
+    {
+        QFileInfo fileInfo(file);
+        IoOpResultType fileCheckResult = fileCheck(fileInfo, Existance::Exist);
+        if(fileCheckResult != IO_SUCCESS)
+            return IoOpReport(IO_OP_READ, fileCheckResult, file);
+
+        IoOpResultType openResult = parsedOpen(&file, QIODevice::ReadOnly);
+        if(openResult != IO_SUCCESS)
+            return IoOpReport(IO_OP_READ, openResult, file);
+    }
+
+    QScopeGuard fileGuard([&file, wasOpen](){ if(!wasOpen) file.close(); });
+
+    // Adjust input indices to true positions
+    qint64 fileIndexMax = file.size() - 1;
+
+    if(startPos > fileIndexMax)
+        return IoOpReport(IO_OP_READ, IO_SUCCESS, file);
+
+    if(endPos.isLast() || endPos > fileIndexMax)
+    {
+        endPos = fileIndexMax;
+        if(startPos.isLast())
+            startPos = fileIndexMax;
+    }
+
+    // Map data
+    qint64 mapSize = length(*startPos, *endPos);
+    uchar* data = file.map(*startPos, mapSize);
+    if(!data)
+    {
+        IoOpResultType mapResult = FILE_DEV_ERR_MAP.value(file.error());
+        return IoOpReport(IO_OP_READ, mapResult != IO_SUCCESS ? mapResult : IO_ERR_READ, file);
+    }
+
+    returnBuffer = FileMapping(file, data, mapSize);
+    return IoOpReport(IO_OP_READ, IO_SUCCESS, file);
+}
+
 namespace
 {
     IoOpReport pWriteBytesToFile(QFileDevice* file, const QByteArray& bytes, WriteMode writeMode, Index64 startPos, const WriteOptions& writeOptions)
@@ -1766,11 +2361,14 @@ namespace
         if(file->isOpen())
             file->close();
 
-        // Post data for Inserts and Overwrites
+        /* Inserts into regular files shift the data that follows the insertion point in place, but a save file
+         * starts out empty and so the post data has to be read from the original and written after the new data
+         */
+        bool insertInPlace = fileInfo.exists() && writeMode == Insert && qobject_cast<QFile*>(file);
         QByteArray afterNew;
 
         // Get post data if required
-        if(fileInfo.exists() && writeMode == Insert)
+        if(fileInfo.exists() && writeMode == Insert && !insertInPlace)
         {
             IoOpReport readAfter = readBytesFromFile(afterNew, auxFile, startPos);
             if(readAfter.isFailure())
@@ -1798,6 +2396,14 @@ namespace
            !writeOptions.testFlag(Pad) && startPos > file->size())
             startPos = file->size();
 
+        // Make room for new data
+        if(insertInPlace)
+        {
+            IoOpResultType shiftResult = insertFileRange(*file, *startPos, bytes.size());
+            if(shiftResult != IO_SUCCESS)
+                return IoOpReport(IO_OP_WRITE, shiftResult, file);
+        }
+
         // Seek to start point
         file->seek(*startPos);
 
@@ -1826,6 +2432,9 @@ namespace
 /*!
  *  Writes the given bytes to @a file.
  *
+ *  When inserting, only the data that follows @a startPos is moved, in place, and so the time this takes is
+ *  proportional to the amount of that data rather than to the size of the file.
+ *
  *  @param[in] file The file to write to.
  *  @param[in] bytes The bytes to be written.
  *  @param[in] writeMode The mode to use for writing.
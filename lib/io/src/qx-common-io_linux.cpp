@@ -1,8 +1,26 @@
 // Unit Includes
 #include "qx/io/qx-common-io.h"
+#include "qx-common-io_p.h"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cerrno>
+#include <vector>
+
+// Qt Includes
+#include <QFile>
+#include <QScopeGuard>
 
 // System Includes
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/falloc.h>
+#include <linux/fs.h>
 
 namespace Qx
 {
@@ -17,4 +35,453 @@ bool createFile(const QString& fileName)
     return mknod(nativeFilename.constData(), S_IFREG|00666, 0) == 0;
 }
 
+/*! @cond */
+void adviseSequentialRead(const QFileDevice& file)
+{
+    // Purely a hint to enable aggressive read-ahead, so failure is irrelevant
+    int fd = file.handle();
+    if(fd != -1)
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+}
+
+namespace
+{
+    bool fallocateRange(QFileDevice& file, int mode, qint64 pos, qint64 length, bool allowEnd)
+    {
+        /* Ranges can only be manipulated in whole filesystem blocks and never at (or for collapses,
+         * through) the end of the file. Anything else, including filesystems without support for
+         * this, is reported as an error that just means the data must be moved manually.
+         */
+        int fd = file.handle();
+        struct stat st;
+        if(fd == -1 || fstat(fd, &st) != 0 || st.st_blksize <= 0)
+            return false;
+
+        qint64 blockSize = st.st_blksize;
+        qint64 limit = allowEnd ? pos : pos + length;
+        if(pos % blockSize != 0 || length % blockSize != 0 || limit >= st.st_size)
+            return false;
+
+        return fallocate(fd, mode, pos, length) == 0;
+    }
+}
+
+bool nativeInsertFileRange(QFileDevice& file, qint64 pos, qint64 length)
+{
+#ifdef FALLOC_FL_INSERT_RANGE
+    return fallocateRange(file, FALLOC_FL_INSERT_RANGE, pos, length, true);
+#else
+    Q_UNUSED(file); Q_UNUSED(pos); Q_UNUSED(length);
+    return false;
+#endif
+}
+
+bool nativeRemoveFileRange(QFileDevice& file, qint64 pos, qint64 length)
+{
+#ifdef FALLOC_FL_COLLAPSE_RANGE
+    return fallocateRange(file, FALLOC_FL_COLLAPSE_RANGE, pos, length, false);
+#else
+    Q_UNUSED(file); Q_UNUSED(pos); Q_UNUSED(length);
+    return false;
+#endif
+}
+
+IoOpResultType resultFromErrno(int error, IoOpType op)
+{
+    switch(error)
+    {
+        case EACCES:
+        case EPERM:
+        case EROFS:
+            return IO_ERR_ACCESS_DENIED;
+        case ENOENT:
+            return IO_ERR_DNE;
+        case EISDIR:
+            return IO_ERR_WRONG_TYPE;
+        case EBADF:
+            return IO_ERR_FILE_NOT_OPEN;
+        case ENOSPC:
+        case EDQUOT:
+        case EFBIG:
+        case ENOMEM:
+        case EMFILE:
+        case ENFILE:
+            return IO_ERR_OUT_OF_RES;
+        case ESPIPE:
+        case EOVERFLOW:
+            return IO_ERR_REPOSITION;
+        case ECANCELED:
+            return IO_ERR_ABORT;
+        case ETIMEDOUT:
+            return IO_ERR_TIMEOUT;
+        default:
+            return op == IO_OP_WRITE ? IO_ERR_WRITE : IO_ERR_READ;
+    }
+}
+
+IoOpResultType nativeReadAt(QFileDevice& file, qint64 pos, std::span<std::byte> buffer, qint64& bytesRead)
+{
+    bytesRead = 0;
+    int fd = file.handle();
+    if(fd == -1)
+        return IO_ERR_FILE_NOT_OPEN;
+
+    while(bytesRead < qint64(buffer.size()))
+    {
+        ssize_t count = pread(fd, buffer.data() + bytesRead, buffer.size() - bytesRead, pos + bytesRead);
+        if(count < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return resultFromErrno(errno, IO_OP_READ);
+        }
+        else if(count == 0)
+            break;
+
+        bytesRead += count;
+    }
+
+    return IO_SUCCESS;
+}
+
+IoOpResultType nativeWriteAt(QFileDevice& file, qint64 pos, std::span<const std::byte> data)
+{
+    int fd = file.handle();
+    if(fd == -1)
+        return IO_ERR_FILE_NOT_OPEN;
+
+    for(qint64 written = 0; written < qint64(data.size());)
+    {
+        ssize_t count = pwrite(fd, data.data() + written, data.size() - written, pos + written);
+        if(count < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return resultFromErrno(errno, IO_OP_WRITE);
+        }
+
+        written += count;
+    }
+
+    return IO_SUCCESS;
+}
+
+namespace
+{
+    enum class Transfer { Done, Unsupported, Failed };
+
+    template<typename Step>
+    Transfer transferAll(qint64 size, Step step)
+    {
+        // Only an error on the first step means the method isn't usable, afterwards it's a genuine failure
+        for(qint64 copied = 0; copied < size;)
+        {
+            ssize_t count = step(size - copied);
+            if(count == 0)
+                break; // Source shrank
+            else if(count < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+
+                bool unsupported = copied == 0 &&
+                                   (errno == EXDEV || errno == ENOSYS || errno == EOPNOTSUPP || errno == EINVAL);
+                return unsupported ? Transfer::Unsupported : Transfer::Failed;
+            }
+
+            copied += count;
+        }
+
+        return Transfer::Done;
+    }
+
+    bool copyFileData(int in, int out, qint64 size)
+    {
+#ifdef FICLONE
+        // Share extents outright on filesystems that support reflinks
+        if(size > 0 && ioctl(out, FICLONE, in) == 0)
+            return true;
+#endif
+
+        // Copy within the kernel, ideally also letting the filesystem offload the copy
+        if(size > 0)
+        {
+            Transfer t = transferAll(size, [=](qint64 remaining){
+                return copy_file_range(in, nullptr, out, nullptr, remaining, 0);
+            });
+            if(t == Transfer::Unsupported)
+            {
+                t = transferAll(size, [=](qint64 remaining){
+                    return sendfile(out, in, nullptr, remaining);
+                });
+            }
+
+            if(t != Transfer::Unsupported)
+                return t == Transfer::Done;
+        }
+
+        // Copy through user space, which is also the only option for files that don't report a size
+        char buffer[128 * 1024];
+        for(ssize_t count; (count = read(in, buffer, sizeof(buffer))) != 0;)
+        {
+            if(count < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+                return false;
+            }
+
+            for(ssize_t written = 0; written < count;)
+            {
+                ssize_t w = write(out, buffer + written, count - written);
+                if(w < 0 && errno != EINTR)
+                    return false;
+                written += std::max(w, ssize_t(0));
+            }
+        }
+
+        return true;
+    }
+}
+
+IoOpResultType nativeCopyFile(const QString& source, const QString& destination)
+{
+    QByteArray nativeSource = QFile::encodeName(source);
+    QByteArray nativeDestination = QFile::encodeName(destination);
+
+    int in = open(nativeSource.constData(), O_RDONLY | O_CLOEXEC);
+    if(in == -1)
+        return errno == EACCES ? IO_ERR_ACCESS_DENIED : errno == ENOENT ? IO_ERR_DNE : IO_ERR_OPEN;
+    QScopeGuard inGuard([in](){ close(in); });
+
+    struct stat st;
+    if(fstat(in, &st) != 0)
+        return IO_ERR_READ;
+
+    // Never replace an existing file, that must be handled by the caller
+    int out = open(nativeDestination.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, st.st_mode & 0777);
+    if(out == -1)
+        return errno == EEXIST ? IO_ERR_EXISTS : errno == EACCES ? IO_ERR_ACCESS_DENIED : IO_ERR_CANT_CREATE;
+
+    bool copied = false;
+    QScopeGuard outGuard([&](){
+        close(out);
+        if(!copied)
+            unlink(nativeDestination.constData());
+    });
+
+    // Match source permissions regardless of umask, like QFile::copy(), which never carries over setuid/setgid/sticky
+    fchmod(out, st.st_mode & 0777);
+
+    copied = copyFileData(in, out, st.st_size);
+    return copied ? IO_SUCCESS : IO_ERR_COPY;
+}
+
+namespace
+{
+    struct RawDirEntry
+    {
+        // Layout of the records returned by getdents64
+        ino64_t d_ino;
+        off64_t d_off;
+        unsigned short d_reclen;
+        unsigned char d_type;
+        char d_name[];
+    };
+
+    struct DirFrame
+    {
+        int fd;
+        QString prefix;
+        QByteArray buffer;
+        long pos;
+        long end;
+    };
+
+    constexpr int DIR_BUFFER_SIZE = 32 * 1024;
+
+    char asciiLower(char c) { return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c; }
+
+    const char* nextUtf8Char(const char* c)
+    {
+        for(++c; (*c & 0xC0) == 0x80; ++c) {}
+        return c;
+    }
+
+    bool wildcardMatch(const char* pattern, const char* name, bool caseSensitive)
+    {
+        // Greedy matching that backtracks to the last '*', where '?' consumes a whole UTF-8 character
+        const char* starPattern = nullptr;
+        const char* starName = nullptr;
+
+        while(*name)
+        {
+            if(*pattern == '*')
+            {
+                starPattern = pattern++;
+                starName = name;
+            }
+            else if(*pattern == '?')
+            {
+                pattern++;
+                name = nextUtf8Char(name);
+            }
+            else if(*pattern && (caseSensitive ? *pattern == *name : asciiLower(*pattern) == asciiLower(*name)))
+            {
+                pattern++;
+                name++;
+            }
+            else if(starPattern)
+            {
+                pattern = starPattern + 1;
+                name = starName = nextUtf8Char(starName);
+            }
+            else
+                return false;
+        }
+
+        while(*pattern == '*')
+            pattern++;
+
+        return !*pattern;
+    }
+
+    bool compileNameFilters(QList<QByteArray>& patterns, const QStringList& nameFilters, bool caseSensitive)
+    {
+        // Only plain wildcards are matched on raw bytes, and without case only ASCII can be folded
+        for(const QString& filter : nameFilters)
+        {
+            QByteArray pattern = filter.toUtf8();
+            for(char c : pattern)
+                if(c == '[' || c == ']' || c == '\\' || (!caseSensitive && (c & 0x80)))
+                    return false;
+
+            patterns.append(pattern);
+        }
+
+        return true;
+    }
+}
+
+bool nativeDirEntries(const QString& path, const QStringList& nameFilters, QDir::Filters filters,
+                      QDirIterator::IteratorFlags flags, const std::function<bool(const DirEntry&)>& visitor,
+                      const std::function<void(const QString&)>& subdirVisitor)
+{
+    if(filters == QDir::NoFilter)
+        filters = QDir::AllEntries;
+
+    // Partial permission filters and following links require full metadata, which QDirIterator handles
+    QDir::Filters permissions = filters & QDir::PermissionMask;
+    if((permissions && permissions != QDir::PermissionMask) || flags.testFlag(QDirIterator::FollowSymlinks))
+        return false;
+
+    QList<QByteArray> patterns;
+    if(!compileNameFilters(patterns, nameFilters, filters.testFlag(QDir::CaseSensitive)))
+        return false;
+
+    const bool recursive = flags.testFlag(QDirIterator::Subdirectories);
+    const bool includeHidden = filters.testFlag(QDir::Hidden);
+    const bool includeSystem = filters.testFlag(QDir::System);
+    const bool allDirs = filters.testFlag(QDir::AllDirs);
+    const bool skipDirs = !(filters & (QDir::Dirs | QDir::AllDirs));
+    const bool skipFiles = !filters.testFlag(QDir::Files);
+    const bool skipSymLinks = filters.testFlag(QDir::NoSymLinks);
+
+    // Directories are walked depth first, with each level's position kept, in the same order as QDirIterator
+    std::vector<DirFrame> stack;
+    QScopeGuard closeGuard([&stack](){
+        for(const DirFrame& frame : stack)
+            close(frame.fd);
+    });
+
+    int rootFd = open(QFile::encodeName(path).constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(rootFd == -1)
+        return true;
+    stack.push_back({rootFd, path.endsWith(u'/') ? path : path + u'/', QByteArray(DIR_BUFFER_SIZE, Qt::Uninitialized), 0, 0});
+
+    while(!stack.empty())
+    {
+        DirFrame& frame = stack.back();
+        if(frame.pos == frame.end)
+        {
+            long read = syscall(SYS_getdents64, frame.fd, frame.buffer.data(), frame.buffer.size());
+            if(read <= 0)
+            {
+                close(frame.fd);
+                stack.pop_back();
+                continue;
+            }
+
+            frame.pos = 0;
+            frame.end = read;
+        }
+
+        auto raw = reinterpret_cast<const RawDirEntry*>(frame.buffer.constData() + frame.pos);
+        frame.pos += raw->d_reclen;
+
+        const char* name = raw->d_name;
+        const bool dotOrDotDot = name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+        const bool hidden = name[0] == '.';
+
+        // Only stat when the entry's type isn't already known, or for the target of links
+        DirEntry::Type type = raw->d_type == DT_DIR ? DirEntry::Directory :
+                              raw->d_type == DT_REG ? DirEntry::File : DirEntry::Other;
+        bool symLink = raw->d_type == DT_LNK;
+        bool exists = true;
+        if(raw->d_type == DT_UNKNOWN || symLink)
+        {
+            struct stat st;
+            if(!symLink && fstatat(frame.fd, name, &st, AT_SYMLINK_NOFOLLOW) == 0)
+                symLink = S_ISLNK(st.st_mode);
+
+            exists = fstatat(frame.fd, name, &st, 0) == 0;
+            if(exists)
+                type = S_ISDIR(st.st_mode) ? DirEntry::Directory : S_ISREG(st.st_mode) ? DirEntry::File : DirEntry::Other;
+        }
+
+        // Note subdirectory to descend into after this entry, like QDirIterator
+        const bool descendable = type == DirEntry::Directory && !symLink && !dotOrDotDot && (allDirs || includeHidden || !hidden);
+        int subFd = -1;
+        if(descendable && recursive)
+            subFd = openat(frame.fd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+        // Apply filters in the same manner as QDirIterator
+        bool matches = true;
+        if(dotOrDotDot && ((name[1] == '\0' && filters.testFlag(QDir::NoDot)) || (name[1] == '.' && filters.testFlag(QDir::NoDotDot))))
+            matches = false;
+        else if(!patterns.isEmpty() && !(allDirs && type == DirEntry::Directory) &&
+                std::none_of(patterns.cbegin(), patterns.cend(), [&](const QByteArray& p){
+                    return wildcardMatch(p.constData(), name, filters.testFlag(QDir::CaseSensitive));
+                }))
+            matches = false;
+        else if(skipSymLinks && symLink && (!includeSystem || exists))
+            matches = false;
+        else if(!includeHidden && !dotOrDotDot && hidden)
+            matches = false;
+        else if(!includeSystem && ((type == DirEntry::Other && !symLink) || (symLink && !exists)))
+            matches = false;
+        else if((skipDirs && type == DirEntry::Directory) || (skipFiles && type == DirEntry::File))
+            matches = false;
+
+        QString entryPath = matches || descendable ? frame.prefix + QFile::decodeName(name) : QString();
+        bool stop = matches && !visitor(DirEntry(entryPath, type, symLink));
+
+        if(subFd != -1)
+        {
+            if(stop)
+                close(subFd);
+            else
+                stack.push_back({subFd, entryPath + u'/', QByteArray(DIR_BUFFER_SIZE, Qt::Uninitialized), 0, 0});
+        }
+        else if(descendable && !recursive && !stop && subdirVisitor)
+            subdirVisitor(entryPath);
+
+        if(stop)
+            break;
+    }
+
+    return true;
+}
+/*! @endcond */
+
 }
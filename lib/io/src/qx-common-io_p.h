@@ -1,13 +1,24 @@
 #ifndef QX_IO_COMMON_P_H
 #define QX_IO_COMMON_P_H
 
+// Standard Library Includes
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <span>
+
 // Qt Includes
+#include <QDirIterator>
 #include <QFileDevice>
+#include <QFuture>
+#include <QPromise>
 #include <QTextStream>
+#include <QThreadPool>
 
 // Intra-component Includes
 #include "qx/io/qx-ioopreport.h"
 #include "qx/io/qx-common-io.h"
+#include "qx/io/qx-direntry.h"
 
 namespace Qx
 {
@@ -17,6 +28,8 @@ namespace Qx
 enum class Existance {Exist, NotExist, Either};
 
 //-Component Private Variables ---------------------------------------------------------------------------------------------
+constexpr qint64 RANGE_SHIFT_BUFFER_SIZE = 1024 * 1024;
+
 extern const QHash<QFileDevice::FileError, IoOpResultType> FILE_DEV_ERR_MAP;
 extern const QHash<QTextStream::Status, IoOpResultType> TXT_STRM_STAT_MAP;
 extern const QHash<QDataStream::Status, IoOpResultType> DATA_STRM_STAT_MAP;
@@ -29,6 +42,31 @@ IoOpResultType directoryCheck(const QFileInfo& dirInfo);
 IoOpReport handlePathCreation(const QFileInfo& fileInfo, bool createPaths);
 IoOpReport writePrep(const QFileInfo& fileInfo, WriteOptions writeOptions);
 void matchAppendConditionParams(WriteMode& writeMode, TextPos& startPos);
+void adviseSequentialRead(const QFileDevice& file);
+
+// Move everything after pos within an open file to make or close a gap, without reading the whole file
+IoOpResultType insertFileRange(QFileDevice& file, qint64 pos, qint64 length);
+IoOpResultType removeFileRange(QFileDevice& file, qint64 pos, qint64 length);
+bool nativeInsertFileRange(QFileDevice& file, qint64 pos, qint64 length);
+bool nativeRemoveFileRange(QFileDevice& file, qint64 pos, qint64 length);
+
+// Read or write at an offset within an open file without seeking; reads only stop short at the end of the file
+IoOpResultType nativeReadAt(QFileDevice& file, qint64 pos, std::span<std::byte> buffer, qint64& bytesRead);
+IoOpResultType nativeWriteAt(QFileDevice& file, qint64 pos, std::span<const std::byte> data);
+#ifdef __linux__
+IoOpResultType resultFromErrno(int error, IoOpType op);
+#endif
+
+// Copy a file's contents and permissions to a new file as directly as the platform allows, failing if it exists
+IoOpResultType nativeCopyFile(const QString& source, const QString& destination);
+
+/* Visit entries like QDirIterator would produce, but without creating a QFileInfo for each. Returns false
+ * without visiting anything if the platform or arguments require QDirIterator. Visiting stops if the visitor
+ * returns false. When not recursing, subdirVisitor is given each subdirectory QDirIterator would descend into.
+ */
+bool nativeDirEntries(const QString& path, const QStringList& nameFilters, QDir::Filters filters,
+                      QDirIterator::IteratorFlags flags, const std::function<bool(const DirEntry&)>& visitor,
+                      const std::function<void(const QString&)>& subdirVisitor = {});
 
 template<typename T>
 void matchAppendConditionParams(WriteMode& writeMode, Index<T>& startPos)
@@ -39,6 +77,49 @@ void matchAppendConditionParams(WriteMode& writeMode, Index<T>& startPos)
     else if(writeMode == Append)
         startPos = Index<T>(Last);
 }
+/* Processes each file with processFile on pool, reporting the result for the file at index i of filePaths at index
+ * i of the returned future, whose progress value is the number of files that have been processed. Files that have
+ * not yet been started when the future is canceled are skipped.
+ */
+template<typename R, typename F>
+QFuture<R> processFiles(QThreadPool& pool, const QStringList& filePaths, F processFile)
+{
+    struct Job
+    {
+        QPromise<R> promise;
+        std::atomic<int> processed = 0;
+        int total;
+    };
+
+    auto job = std::make_shared<Job>();
+    job->total = filePaths.size();
+
+    QFuture<R> future = job->promise.future();
+    job->promise.start();
+    job->promise.setProgressRange(0, job->total);
+
+    if(filePaths.isEmpty())
+    {
+        job->promise.finish();
+        return future;
+    }
+
+    for(int i = 0; i < job->total; ++i)
+    {
+        pool.start([job, i, filePath = filePaths.at(i), processFile]{
+            if(!job->promise.isCanceled())
+                job->promise.addResult(processFile(filePath), i);
+
+            int processed = ++job->processed;
+            job->promise.setProgressValue(processed);
+            if(processed == job->total)
+                job->promise.finish();
+        });
+    }
+
+    return future;
+}
+
 /*! @endcond */
 }
 
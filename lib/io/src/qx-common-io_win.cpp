@@ -1,9 +1,17 @@
 // Unit Includes
 #include "qx/io/qx-common-io.h"
+#include "qx-common-io_p.h"
+
+// Standard Library Includes
+#include <algorithm>
+
+// Qt Includes
+#include <QDir>
 
 // Windows Includes
 #define WIN32_LEAN_AND_MEAN
 #include "windows.h"
+#include <io.h>
 
 namespace Qx
 {
@@ -29,4 +37,178 @@ bool createFile(const QString& fileName)
         return false;
 }
 
+/*! @cond */
+void adviseSequentialRead(const QFileDevice& file)
+{
+    /* Windows only accepts this hint (FILE_FLAG_SEQUENTIAL_SCAN) when a file is opened, which
+     * QFile doesn't allow control over, and its cache manager detects sequential access anyway
+     */
+    Q_UNUSED(file);
+}
+
+bool nativeInsertFileRange(QFileDevice& file, qint64 pos, qint64 length)
+{
+    // Windows has no means of shifting file contents without rewriting them
+    Q_UNUSED(file); Q_UNUSED(pos); Q_UNUSED(length);
+    return false;
+}
+
+bool nativeRemoveFileRange(QFileDevice& file, qint64 pos, qint64 length)
+{
+    Q_UNUSED(file); Q_UNUSED(pos); Q_UNUSED(length);
+    return false;
+}
+
+namespace
+{
+    // Largest transfer made by a single ReadFile()/WriteFile() call
+    constexpr qint64 MAX_TRANSFER_CHUNK = 1024 * 1024 * 1024;
+
+    HANDLE nativeHandle(QFileDevice& file)
+    {
+        int fd = file.handle();
+        return fd == -1 ? INVALID_HANDLE_VALUE : reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+    }
+
+    OVERLAPPED overlappedAt(qint64 pos)
+    {
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(pos);
+        overlapped.OffsetHigh = static_cast<DWORD>(pos >> 32);
+        return overlapped;
+    }
+
+    /* On a handle opened for synchronous access ReadFile()/WriteFile() still move the file pointer to
+     * the end of the transfer when given an offset, so it's put back once positional access is done
+     */
+    class FilePointerGuard
+    {
+    private:
+        HANDLE mHandle;
+        LARGE_INTEGER mPos;
+        bool mSaved;
+
+    public:
+        FilePointerGuard(HANDLE handle) :
+            mHandle(handle),
+            mPos{}
+        {
+            mSaved = SetFilePointerEx(mHandle, LARGE_INTEGER{}, &mPos, FILE_CURRENT);
+        }
+
+        ~FilePointerGuard()
+        {
+            if(mSaved)
+                SetFilePointerEx(mHandle, mPos, nullptr, FILE_BEGIN);
+        }
+
+        FilePointerGuard(const FilePointerGuard&) = delete;
+        FilePointerGuard& operator=(const FilePointerGuard&) = delete;
+    };
+
+    IoOpResultType resultFromLastError(IoOpType op)
+    {
+        switch(GetLastError())
+        {
+            case ERROR_ACCESS_DENIED:
+            case ERROR_LOCK_VIOLATION:
+                return IO_ERR_ACCESS_DENIED;
+            case ERROR_INVALID_HANDLE:
+                return IO_ERR_FILE_NOT_OPEN;
+            case ERROR_DISK_FULL:
+            case ERROR_HANDLE_DISK_FULL:
+            case ERROR_NOT_ENOUGH_MEMORY:
+            case ERROR_OUTOFMEMORY:
+                return IO_ERR_OUT_OF_RES;
+            case ERROR_OPERATION_ABORTED:
+                return IO_ERR_ABORT;
+            default:
+                return op == IO_OP_WRITE ? IO_ERR_WRITE : IO_ERR_READ;
+        }
+    }
+}
+
+IoOpResultType nativeReadAt(QFileDevice& file, qint64 pos, std::span<std::byte> buffer, qint64& bytesRead)
+{
+    bytesRead = 0;
+    HANDLE handle = nativeHandle(file);
+    if(handle == INVALID_HANDLE_VALUE)
+        return IO_ERR_FILE_NOT_OPEN;
+
+    // An explicit offset makes the read independent of the handle's position
+    FilePointerGuard pointerGuard(handle);
+    while(bytesRead < qint64(buffer.size()))
+    {
+        OVERLAPPED overlapped = overlappedAt(pos + bytesRead);
+        DWORD chunk = static_cast<DWORD>(std::min(qint64(buffer.size()) - bytesRead, MAX_TRANSFER_CHUNK));
+        DWORD count;
+        if(!ReadFile(handle, buffer.data() + bytesRead, chunk, &count, &overlapped))
+        {
+            if(GetLastError() == ERROR_HANDLE_EOF)
+                break;
+            return resultFromLastError(IO_OP_READ);
+        }
+        else if(count == 0)
+            break;
+
+        bytesRead += count;
+    }
+
+    return IO_SUCCESS;
+}
+
+IoOpResultType nativeWriteAt(QFileDevice& file, qint64 pos, std::span<const std::byte> data)
+{
+    HANDLE handle = nativeHandle(file);
+    if(handle == INVALID_HANDLE_VALUE)
+        return IO_ERR_FILE_NOT_OPEN;
+
+    FilePointerGuard pointerGuard(handle);
+    for(qint64 written = 0; written < qint64(data.size());)
+    {
+        OVERLAPPED overlapped = overlappedAt(pos + written);
+        DWORD chunk = static_cast<DWORD>(std::min(qint64(data.size()) - written, MAX_TRANSFER_CHUNK));
+        DWORD count;
+        if(!WriteFile(handle, data.data() + written, chunk, &count, &overlapped))
+            return resultFromLastError(IO_OP_WRITE);
+
+        written += count;
+    }
+
+    return IO_SUCCESS;
+}
+
+IoOpResultType nativeCopyFile(const QString& source, const QString& destination)
+{
+    // CopyFile already copies within the kernel and uses block cloning where supported
+    QString nativeSource = QDir::toNativeSeparators(source);
+    QString nativeDestination = QDir::toNativeSeparators(destination);
+
+    if(CopyFileW((const wchar_t*)nativeSource.utf16(), (const wchar_t*)nativeDestination.utf16(), TRUE))
+        return IO_SUCCESS;
+
+    switch(GetLastError())
+    {
+        case ERROR_FILE_EXISTS:
+        case ERROR_ALREADY_EXISTS:
+            return IO_ERR_EXISTS;
+        case ERROR_ACCESS_DENIED:
+            return IO_ERR_ACCESS_DENIED;
+        case ERROR_FILE_NOT_FOUND:
+            return IO_ERR_DNE;
+        default:
+            return IO_ERR_COPY;
+    }
+}
+
+bool nativeDirEntries(const QString& path, const QStringList& nameFilters, QDir::Filters filters,
+                      QDirIterator::IteratorFlags flags, const std::function<bool(const DirEntry&)>& visitor,
+                      const std::function<void(const QString&)>& subdirVisitor)
+{
+    // QDirIterator is already backed by FindFirstFileEx, which provides the needed metadata in bulk
+    Q_UNUSED(path); Q_UNUSED(nameFilters); Q_UNUSED(filters); Q_UNUSED(flags); Q_UNUSED(visitor); Q_UNUSED(subdirVisitor);
+    return false;
+}
+/*! @endcond */
+
 }
@@ -0,0 +1,272 @@
+// Unit Includes
+#include "qx/io/qx-directorycopier.h"
+
+// Standard Library Includes
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+// Qt Includes
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QPromise>
+#include <QSemaphore>
+
+// Intra-component Includes
+#include "qx-common-io_p.h"
+
+namespace Qx
+{
+
+//===============================================================================================================
+// DirectoryCopier
+//===============================================================================================================
+
+/*!
+ *  @class DirectoryCopier qx/io/qx-directorycopier.h
+ *  @ingroup qx-io
+ *
+ *  @brief The DirectoryCopier class copies directory trees, working on many files at once.
+ *
+ *  Copying a tree that consists of a large number of files one after another spends most of its time
+ *  waiting on the latency of each individual file operation. A directory copier instead walks the source
+ *  directory on a dedicated thread and hands each file off to its own thread pool as soon as it's found, so
+ *  that enumeration and copying overlap and several files are copied at once. Each directory is created
+ *  before any of the files within it are handed off, and the number of files waiting to be copied is kept
+ *  small so that memory use doesn't grow with the size of the tree.
+ *
+ *  File data is copied as directly as the platform allows. On Linux, files are cloned when the filesystem
+ *  supports reflinks, and otherwise are copied within the kernel using @c copy_file_range() or @c sendfile();
+ *  on Windows, @c CopyFile() is used. Permissions are copied along with the data.
+ *
+ *  The outcome of the entire operation is reported as the sole result of the returned future, and is the
+ *  first failure encountered, if any. The future's progress value is the number of files that have been
+ *  processed and its maximum is the number of files found so far, which becomes the total once the whole
+ *  tree has been walked:
+ *
+ *  @code{.cpp}
+ *  Qx::DirectoryCopier copier(Qx::Replace);
+ *  QFuture<Qx::IoOpReport> future = copier.copy(QDir(u"assets"_s), QDir(u"/mnt/build/assets"_s));
+ *
+ *  auto watcher = new QFutureWatcher<Qx::IoOpReport>(this);
+ *  connect(watcher, &QFutureWatcherBase::progressValueChanged, progressBar, &QProgressBar::setValue);
+ *  connect(watcher, &QFutureWatcherBase::progressRangeChanged, progressBar, &QProgressBar::setRange);
+ *  connect(watcher, &QFutureWatcherBase::finished, this, [=]{
+ *      if(watcher->result().isFailure())
+ *          qWarning() << watcher->result().outcomeInfo();
+ *  });
+ *  watcher->setFuture(future);
+ *  @endcode
+ *
+ *  Conflicts with existing files are handled according to the copier's ReplaceMode, just like with
+ *  copyDirectory(). Existing files are detected as the tree is walked, so with ReplaceMode::Stop no file that
+ *  is found after a conflict is copied. Any failure stops the copy as soon as the files that are already being
+ *  copied are finished, as does canceling the future. Since files are copied concurrently, which files were
+ *  copied before the copy stopped is not deterministic.
+ *
+ *  A single copier can run several copies at once, each walking its own tree while sharing the copier's
+ *  threads for copying.
+ *
+ *  @sa copyDirectory().
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a directory copier that handles existing files according to @a replaceMode, with at most
+ *  @a maxThreadCount files being copied at once.
+ */
+DirectoryCopier::DirectoryCopier(ReplaceMode replaceMode, int maxThreadCount) :
+    mReplaceMode(replaceMode)
+{
+    setMaxThreadCount(maxThreadCount);
+}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the directory copier, after waiting for all copies that are in progress to finish.
+ */
+DirectoryCopier::~DirectoryCopier() { waitForDone(); }
+
+//-Class Functions---------------------------------------------------------------------------------------------
+//Private:
+IoOpReport DirectoryCopier::copyFile(const QString& source, const QString& destination, ReplaceMode replaceMode)
+{
+    QFile destinationFile(destination);
+
+    if(destinationFile.exists())
+    {
+        if(replaceMode == ReplaceMode::Skip)
+            return IoOpReport(IO_OP_WRITE, IO_SUCCESS, destinationFile);
+        else if(replaceMode == ReplaceMode::Stop)
+            return IoOpReport(IO_OP_WRITE, IO_ERR_EXISTS, destinationFile);
+        else if(!destinationFile.remove())
+            return IoOpReport(IO_OP_WRITE, IO_ERR_REMOVE, destinationFile);
+    }
+
+    return IoOpReport(IO_OP_WRITE, nativeCopyFile(source, destination), destinationFile);
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the mode that determines how existing files are handled.
+ */
+ReplaceMode DirectoryCopier::replaceMode() const { return mReplaceMode; }
+
+/*!
+ *  Returns the maximum number of files that are copied at once.
+ */
+int DirectoryCopier::maxThreadCount() const { return mPool.maxThreadCount(); }
+
+/*!
+ *  Sets the mode that determines how existing files are handled to @a replaceMode.
+ *
+ *  This only affects copies that are started afterwards.
+ */
+void DirectoryCopier::setReplaceMode(ReplaceMode replaceMode) { mReplaceMode = replaceMode; }
+
+/*!
+ *  Sets the maximum number of files that are copied at once to @a maxThreadCount, which is raised
+ *  to @c 1 if it's lower.
+ */
+void DirectoryCopier::setMaxThreadCount(int maxThreadCount) { mPool.setMaxThreadCount(std::max(maxThreadCount, 1)); }
+
+/*!
+ *  Starts copying the contents of @a directory to @a destination, recursively if @a recursive is @c true,
+ *  and returns a future through which the outcome of the copy can be accessed.
+ *
+ *  @a destination is created if it doesn't exist.
+ */
+QFuture<IoOpReport> DirectoryCopier::copy(const QDir& directory, const QDir& destination, bool recursive)
+{
+    return copy(directory, destination, recursive, mReplaceMode);
+}
+
+/*!
+ *  @overload
+ *
+ *  Starts copying the contents of @a directory to @a destination, handling existing files according to
+ *  @a replaceMode instead of the copier's replace mode.
+ */
+QFuture<IoOpReport> DirectoryCopier::copy(const QDir& directory, const QDir& destination, bool recursive, ReplaceMode replaceMode)
+{
+    struct Job
+    {
+        QPromise<IoOpReport> promise;
+        QSemaphore queueSlots;
+        QDir destination;
+        std::atomic<int> pending = 1; // Enumeration counts until it's finished
+        std::atomic<int> processed = 0;
+        std::atomic<bool> failed = false;
+        IoOpReport failure; // Only written by whichever task fails first
+
+        Job(int queueDepth, const QDir& dest) : queueSlots(queueDepth), destination(dest) {}
+
+        bool isStopped() const { return failed || promise.isCanceled(); }
+
+        void fail(const IoOpReport& report)
+        {
+            if(!failed.exchange(true))
+                failure = report;
+        }
+
+        void release()
+        {
+            if(--pending != 0)
+                return;
+
+            promise.addResult(failed ? failure : IoOpReport(IO_OP_WRITE, IO_SUCCESS, destination));
+            promise.finish();
+        }
+    };
+
+    auto job = std::make_shared<Job>(mPool.maxThreadCount() * QUEUED_COPIES_PER_THREAD, destination);
+
+    QFuture<IoOpReport> future = job->promise.future();
+    job->promise.start();
+
+    // Ensure destination exists
+    if(!destination.mkpath(u"."_s))
+    {
+        job->promise.addResult(IoOpReport(IO_OP_WRITE, IO_ERR_CANT_CREATE, destination));
+        job->promise.finish();
+        return future;
+    }
+
+    // Both pools are drained on destruction, so the copy pool outlives the enumeration
+    QThreadPool* copyPool = &mPool;
+
+    mEnumerationPool.start([job, copyPool, directory, recursive, replaceMode]{
+        QString sourceRoot = directory.absolutePath();
+        QDirIterator srcItr(directory.path(), QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs,
+                            recursive ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags);
+
+        int discovered = 0;
+        while(srcItr.hasNext() && !job->isStopped())
+        {
+            srcItr.next();
+            QFileInfo fi = srcItr.fileInfo();
+
+            QString subPath = fi.absoluteFilePath().mid(sourceRoot.length() + 1); // Drop last '/'
+            QString absDestPath = job->destination.absoluteFilePath(subPath);
+
+            if(fi.isDir())
+            {
+                // Directories are always seen before their contents, so this builds the skeleton ahead of the copies
+                if(!job->destination.mkpath(subPath))
+                    job->fail(IoOpReport(IO_OP_WRITE, IO_ERR_CANT_CREATE, QDir(absDestPath)));
+            }
+            else if(fi.isFile())
+            {
+                if(++discovered % PROGRESS_RANGE_INTERVAL == 0)
+                    job->promise.setProgressRange(0, discovered);
+
+                // Settle conflicts here so that nothing is queued after one that stops the copy
+                if(replaceMode != ReplaceMode::Replace && QFileInfo::exists(absDestPath))
+                {
+                    if(replaceMode == ReplaceMode::Stop)
+                        job->fail(IoOpReport(IO_OP_WRITE, IO_ERR_EXISTS, QFileInfo(absDestPath)));
+                    else
+                        job->promise.setProgressValue(++job->processed);
+                    continue;
+                }
+
+                // Limit the number of queued copies
+                job->queueSlots.acquire();
+                ++job->pending;
+
+                copyPool->start([job, source = fi.absoluteFilePath(), absDestPath, replaceMode]{
+                    if(!job->isStopped())
+                    {
+                        IoOpReport report = copyFile(source, absDestPath, replaceMode);
+                        if(report.isFailure())
+                            job->fail(report);
+                    }
+
+                    job->promise.setProgressValue(++job->processed);
+                    job->queueSlots.release();
+                    job->release();
+                });
+            }
+        }
+
+        job->promise.setProgressRange(0, discovered);
+        job->release();
+    });
+
+    return future;
+}
+
+/*!
+ *  Blocks until all copies that have been started with the copier have finished.
+ */
+void DirectoryCopier::waitForDone()
+{
+    mEnumerationPool.waitForDone();
+    mPool.waitForDone();
+}
+
+}
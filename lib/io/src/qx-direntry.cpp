@@ -0,0 +1,122 @@
+// Unit Includes
+#include "qx/io/qx-direntry.h"
+
+namespace Qx
+{
+
+//===============================================================================================================
+// DirEntry
+//===============================================================================================================
+
+/*!
+ *  @class DirEntry qx/io/qx-direntry.h
+ *  @ingroup qx-io
+ *
+ *  @brief The DirEntry class is a lightweight description of an entry within a directory.
+ *
+ *  Unlike QFileInfo, a directory entry only records an entry's path and type, which are often all that's
+ *  known about an entry after enumerating a directory. This makes it far cheaper to produce in bulk, and
+ *  a full QFileInfo can still be obtained with fileInfo() for the entries that need one.
+ *
+ *  @sa dirContentEntryList().
+ */
+
+//-Class Enums--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  @enum DirEntry::Type
+ *
+ *  This enum describes the type of a directory entry. For symbolic links, this is the type of their target.
+ *
+ *  @var DirEntry::Type DirEntry::Null
+ *  The entry is null.
+ *
+ *  @var DirEntry::Type DirEntry::File
+ *  The entry is a regular file.
+ *
+ *  @var DirEntry::Type DirEntry::Directory
+ *  The entry is a directory.
+ *
+ *  @var DirEntry::Type DirEntry::Other
+ *  The entry is something else, such as a device, pipe, socket, or broken symbolic link.
+ */
+
+//-Constructor---------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a null directory entry.
+ */
+DirEntry::DirEntry() :
+    mType(Null),
+    mSymLink(false)
+{}
+
+/*!
+ *  Constructs a directory entry at @a path of type @a type, which is a symbolic link if @a symLink
+ *  is @c true.
+ */
+DirEntry::DirEntry(const QString& path, Type type, bool symLink) :
+    mPath(path),
+    mType(type),
+    mSymLink(symLink)
+{}
+
+/*!
+ *  Constructs a directory entry that describes the same entry as @a fileInfo.
+ */
+DirEntry::DirEntry(const QFileInfo& fileInfo) :
+    mPath(fileInfo.filePath()),
+    mType(fileInfo.isDir() ? Directory : fileInfo.isFile() ? File : Other),
+    mSymLink(fileInfo.isSymLink())
+{}
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns @c true if the entry is null; otherwise, returns @c false.
+ */
+bool DirEntry::isNull() const { return mType == Null; }
+
+/*!
+ *  Returns the path of the entry, which is relative if the directory it was found in was specified
+ *  with a relative path.
+ */
+QString DirEntry::path() const { return mPath; }
+
+/*!
+ *  Returns the name of the entry, excluding its path.
+ */
+QString DirEntry::fileName() const { return mPath.sliced(mPath.lastIndexOf(u'/') + 1); }
+
+/*!
+ *  Returns the type of the entry.
+ */
+DirEntry::Type DirEntry::type() const { return mType; }
+
+/*!
+ *  Returns @c true if the entry is a regular file, or a symbolic link to one; otherwise, returns @c false.
+ */
+bool DirEntry::isFile() const { return mType == File; }
+
+/*!
+ *  Returns @c true if the entry is a directory, or a symbolic link to one; otherwise, returns @c false.
+ */
+bool DirEntry::isDir() const { return mType == Directory; }
+
+/*!
+ *  Returns @c true if the entry is a symbolic link; otherwise, returns @c false.
+ */
+bool DirEntry::isSymLink() const { return mSymLink; }
+
+/*!
+ *  Returns a QFileInfo for the entry.
+ */
+QFileInfo DirEntry::fileInfo() const { return QFileInfo(mPath); }
+
+/*!
+ *  @fn bool DirEntry::operator==(const DirEntry& other) const
+ *
+ *  Returns @c true if this entry has the same path and type as @a other; otherwise, returns @c false.
+ */
+
+}
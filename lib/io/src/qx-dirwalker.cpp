@@ -0,0 +1,358 @@
+// Unit Includes
+#include "qx/io/qx-dirwalker.h"
+
+// Standard Library Includes
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+// Qt Includes
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QMutex>
+#include <QPromise>
+#include <QWaitCondition>
+
+// Intra-component Includes
+#include "qx-common-io_p.h"
+
+namespace Qx
+{
+
+namespace
+{
+    struct WalkTask
+    {
+        QString path;
+        int depth;
+    };
+
+    // The owning worker takes from the back, so it stays deep within the branch it's on, while other workers
+    // steal from the front, which holds the directories closest to the root and therefore the most work
+    struct WalkDeque
+    {
+        QMutex mutex;
+        std::deque<WalkTask> tasks;
+    };
+
+    struct Walk
+    {
+        QPromise<IoOpReport> promise;
+        QDir root;
+        DirWalker::Visitor visitor;
+        QStringList nameFilters;
+        QDir::Filters filters;
+        int maxDepth;
+
+        std::vector<WalkDeque> deques;
+        std::atomic<qint64> queued = 0; // Tasks waiting in a deque
+        std::atomic<qint64> pending = 0; // Tasks waiting or being listed
+        std::atomic<int> running; // Workers that haven't exited
+        std::atomic<int> listed = 0;
+        QMutex idleMutex;
+        QWaitCondition workAvailable;
+        int idle = 0; // Guarded by idleMutex
+
+        Walk(int workers, const QDir& dir, const DirWalker::Visitor& vis, const QStringList& nf, QDir::Filters f, int md) :
+            root(dir),
+            visitor(vis),
+            nameFilters(nf),
+            filters(f),
+            maxDepth(md),
+            deques(workers),
+            running(workers)
+        {}
+
+        bool isStopped() const { return promise.isCanceled(); }
+
+        void push(int worker, WalkTask task)
+        {
+            // Count the task first so that it can't be finished before it's counted
+            ++pending;
+            ++queued;
+
+            {
+                WalkDeque& deque = deques[worker];
+                QMutexLocker locker(&deque.mutex);
+                deque.tasks.push_back(std::move(task));
+            }
+
+            // Checked under the mutex so that a worker can't start waiting after the check without seeing the task
+            QMutexLocker idleLocker(&idleMutex);
+            if(idle > 0)
+                workAvailable.wakeOne();
+        }
+
+        void wakeAll()
+        {
+            QMutexLocker idleLocker(&idleMutex);
+            workAvailable.wakeAll();
+        }
+
+        bool take(int worker, WalkTask& task)
+        {
+            int count = deques.size();
+            for(int i = 0; i < count; ++i)
+            {
+                WalkDeque& deque = deques[(worker + i) % count];
+                QMutexLocker locker(&deque.mutex);
+                if(deque.tasks.empty())
+                    continue;
+
+                if(i == 0)
+                {
+                    task = std::move(deque.tasks.back());
+                    deque.tasks.pop_back();
+                }
+                else
+                {
+                    task = std::move(deque.tasks.front());
+                    deque.tasks.pop_front();
+                }
+
+                --queued;
+                return true;
+            }
+
+            return false;
+        }
+
+        void list(int worker, const WalkTask& task)
+        {
+            bool descend = maxDepth < 0 || task.depth < maxDepth;
+
+            std::function<void(const QString&)> queueSubdir;
+            if(descend)
+                queueSubdir = [&](const QString& path){ push(worker, {path, task.depth + 1}); };
+
+            // Use the fast path if possible
+            if(!nativeDirEntries(task.path, nameFilters, filters, QDirIterator::NoIteratorFlags, [this](const DirEntry& entry){
+                visitor(entry);
+                return !isStopped();
+            }, queueSubdir))
+            {
+                QDirIterator entryItr(task.path, nameFilters, filters);
+                while(entryItr.hasNext() && !isStopped())
+                {
+                    entryItr.next();
+                    visitor(DirEntry(entryItr.fileInfo()));
+                }
+
+                if(descend)
+                {
+                    // Descend into the same directories QDirIterator would, other than symlinks, which aren't followed
+                    QDir::Filters dirFilters = QDir::Dirs | QDir::NoDotAndDotDot | QDir::NoSymLinks;
+                    if(filters & (QDir::AllDirs | QDir::Hidden))
+                        dirFilters |= QDir::Hidden;
+
+                    QDirIterator dirItr(task.path, dirFilters);
+                    while(dirItr.hasNext() && !isStopped())
+                        queueSubdir(dirItr.next());
+                }
+            }
+
+            promise.setProgressValue(++listed);
+        }
+
+        void work(int worker)
+        {
+            while(!isStopped())
+            {
+                WalkTask task;
+                if(!take(worker, task))
+                {
+                    /* Wait for another worker to find more directories, or for the walk to end. Some other worker
+                     * is always listing while this one waits, and wakes it once it sees the walk end or get canceled
+                     */
+                    QMutexLocker idleLocker(&idleMutex);
+                    ++idle;
+                    while(queued <= 0 && pending != 0 && !isStopped())
+                        workAvailable.wait(&idleMutex);
+                    --idle;
+
+                    if(pending == 0)
+                        break;
+                    continue;
+                }
+
+                list(worker, task);
+
+                if(--pending == 0)
+                    wakeAll();
+            }
+
+            // Deliver cancellation to the workers that are waiting
+            if(isStopped())
+                wakeAll();
+
+            if(--running == 0)
+            {
+                promise.addResult(IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, root));
+                promise.finish();
+            }
+        }
+    };
+}
+
+//===============================================================================================================
+// DirWalker
+//===============================================================================================================
+
+/*!
+ *  @class DirWalker qx/io/qx-dirwalker.h
+ *  @ingroup qx-io
+ *
+ *  @brief The DirWalker class recursively enumerates directories using multiple threads.
+ *
+ *  Enumerating a large directory tree with dirContentInfoList() or QDirIterator lists one directory at a
+ *  time, so the time taken grows with the latency of each listing, which is significant on network shares
+ *  and slow disks. A directory walker instead lists several directories at once, with each of its threads
+ *  working through its own share of the tree and taking directories from the others whenever it runs out,
+ *  so that all threads stay busy regardless of the tree's shape.
+ *
+ *  Entries are passed to a visitor function as they're found, in no particular order, and are the same as
+ *  those that would be produced by a QDirIterator created with the walker's name filters and filters and the
+ *  QDirIterator::Subdirectories flag, except that symbolic links to directories are never followed. The depth
+ *  of the walk can be limited with setMaxDepth().
+ *
+ *  @code{.cpp}
+ *  QMutex mutex;
+ *  qint64 totalSize = 0;
+ *
+ *  Qx::DirWalker walker;
+ *  walker.setNameFilters({u"*.mkv"_s, u"*.mp4"_s});
+ *  walker.setFilters(QDir::Files);
+ *
+ *  QFuture<Qx::IoOpReport> future = walker.walk(QDir(u"/mnt/media"_s), [&](const Qx::DirEntry& entry){
+ *      qint64 size = entry.fileInfo().size();
+ *      QMutexLocker locker(&mutex);
+ *      totalSize += size;
+ *  });
+ *  future.waitForFinished();
+ *  @endcode
+ *
+ *  The visitor is invoked from the walker's threads, potentially from several at once, and so must be
+ *  thread-safe. Canceling the returned future stops the walk as soon as the directories that are currently
+ *  being listed are finished. The future's progress value is the number of directories that have been listed.
+ *
+ *  @sa dirContentEntryList().
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a directory walker that lists at most @a maxThreadCount directories at once.
+ *
+ *  The walker initially has no name filters, uses QDir::NoFilter, and has no maximum depth.
+ */
+DirWalker::DirWalker(int maxThreadCount) :
+    mFilters(QDir::NoFilter),
+    mMaxDepth(-1)
+{
+    setMaxThreadCount(maxThreadCount);
+}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the directory walker, after waiting for all walks that are in progress to finish.
+ */
+DirWalker::~DirWalker() { waitForDone(); }
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the name filters that entries must match in order to be visited.
+ */
+QStringList DirWalker::nameFilters() const { return mNameFilters; }
+
+/*!
+ *  Returns the filters that entries must match in order to be visited.
+ */
+QDir::Filters DirWalker::filters() const { return mFilters; }
+
+/*!
+ *  Returns the maximum number of levels below the walked directory that are descended into, or @c -1
+ *  if there's no limit.
+ */
+int DirWalker::maxDepth() const { return mMaxDepth; }
+
+/*!
+ *  Returns the maximum number of directories that are listed at once.
+ */
+int DirWalker::maxThreadCount() const { return mPool.maxThreadCount(); }
+
+/*!
+ *  Sets the name filters that entries must match in order to be visited to @a nameFilters.
+ *
+ *  This only affects walks that are started afterwards.
+ *
+ *  @sa QDir::setNameFilters().
+ */
+void DirWalker::setNameFilters(const QStringList& nameFilters) { mNameFilters = nameFilters; }
+
+/*!
+ *  Sets the filters that entries must match in order to be visited to @a filters.
+ *
+ *  As with QDirIterator, hidden directories are only descended into if @a filters includes QDir::Hidden
+ *  or QDir::AllDirs. This only affects walks that are started afterwards.
+ */
+void DirWalker::setFilters(QDir::Filters filters) { mFilters = filters; }
+
+/*!
+ *  Sets the maximum number of levels below the walked directory that are descended into to @a maxDepth.
+ *
+ *  A value of @c 0 only visits the entries of the walked directory itself, and any negative value removes
+ *  the limit. This only affects walks that are started afterwards.
+ */
+void DirWalker::setMaxDepth(int maxDepth) { mMaxDepth = std::max(maxDepth, -1); }
+
+/*!
+ *  Sets the maximum number of directories that are listed at once to @a maxThreadCount, which is raised
+ *  to @c 1 if it's lower.
+ *
+ *  This only affects walks that are started afterwards.
+ */
+void DirWalker::setMaxThreadCount(int maxThreadCount) { mPool.setMaxThreadCount(std::max(maxThreadCount, 1)); }
+
+/*!
+ *  Starts walking @a directory, passing each entry found to @a visitor, and returns a future through which
+ *  the outcome of the walk can be accessed.
+ *
+ *  The outcome is only a failure if @a directory itself cannot be enumerated; subdirectories that cannot be
+ *  read are skipped, just as with QDirIterator.
+ */
+QFuture<IoOpReport> DirWalker::walk(const QDir& directory, const Visitor& visitor)
+{
+    int workers = mPool.maxThreadCount();
+    auto walk = std::make_shared<Walk>(workers, directory, visitor, mNameFilters, mFilters, mMaxDepth);
+
+    QFuture<IoOpReport> future = walk->promise.future();
+    walk->promise.start();
+
+    // Check directory
+    QFileInfo dirInfo(directory.path());
+    IoOpResultType dirCheckResult = directoryCheck(dirInfo);
+    if(dirCheckResult != IO_SUCCESS)
+    {
+        walk->promise.addResult(IoOpReport(IO_OP_ENUMERATE, dirCheckResult, directory));
+        walk->promise.finish();
+        return future;
+    }
+
+    // Seed the first worker, the rest will steal from it
+    walk->push(0, {directory.path(), 0});
+    for(int i = 0; i < workers; ++i)
+        mPool.start([walk, i]{ walk->work(i); });
+
+    return future;
+}
+
+/*!
+ *  Blocks until all walks that have been started with the walker have finished.
+ */
+void DirWalker::waitForDone() { mPool.waitForDone(); }
+
+}
@@ -0,0 +1,133 @@
+// Unit Includes
+#include "qx/io/qx-filemapping.h"
+
+// Standard Library Includes
+#include <utility>
+
+namespace Qx
+{
+
+//===============================================================================================================
+// FileMapping
+//===============================================================================================================
+
+/*!
+ *  @class FileMapping qx/io/qx-filemapping.h
+ *  @ingroup qx-io
+ *
+ *  @brief The FileMapping class provides read-only access to a range of a file that has been mapped into
+ *  memory.
+ *
+ *  A file mapping is produced by mapBytesFromFile() and gives direct access to the contents of a file without
+ *  copying them into a buffer, with pages being loaded by the operating system as they're accessed. This is
+ *  ideal for reading scattered records from large files, or for handing a file's contents to an API that
+ *  accepts a pointer and length.
+ *
+ *  The range is unmapped when the mapping is destroyed or unmap() is called. Mappings can be moved, but
+ *  not copied.
+ *
+ *  Since mappings are managed by the QFile that they were created with, that file object must outlive
+ *  the mapping and must not be used to open another file while the mapping exists, though the file may be
+ *  closed. Changes made to the underlying file by any means are generally visible through the mapping, and
+ *  truncating the file while it's mapped results in undefined behavior.
+ *
+ *  @sa mapBytesFromFile().
+ */
+
+//-Constructor---------------------------------------------------------------------------------------------------
+//Private:
+FileMapping::FileMapping(QFileDevice& file, uchar* data, qint64 size) :
+    mFile(&file),
+    mData(data),
+    mSize(size)
+{}
+
+//Public:
+/*!
+ *  Constructs a null file mapping.
+ */
+FileMapping::FileMapping() :
+    mFile(nullptr),
+    mData(nullptr),
+    mSize(0)
+{}
+
+/*!
+ *  Constructs a file mapping by taking over the range mapped by @a other, which becomes null.
+ */
+FileMapping::FileMapping(FileMapping&& other) :
+    mFile(std::exchange(other.mFile, nullptr)),
+    mData(std::exchange(other.mData, nullptr)),
+    mSize(std::exchange(other.mSize, 0))
+{}
+
+//-Destructor----------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the file mapping, unmapping its range.
+ */
+FileMapping::~FileMapping() { unmap(); }
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns @c true if the mapping is null; otherwise, returns @c false.
+ *
+ *  A mapping of an empty range is null.
+ */
+bool FileMapping::isNull() const { return !mData; }
+
+/*!
+ *  Returns a pointer to the first byte of the mapped range, or @c nullptr if the mapping is null.
+ */
+const char* FileMapping::data() const { return reinterpret_cast<const char*>(mData); }
+
+/*!
+ *  Returns the size of the mapped range, in bytes.
+ */
+qint64 FileMapping::size() const { return mSize; }
+
+/*!
+ *  Returns a view of the mapped range.
+ *
+ *  The view is only valid while the range is mapped.
+ */
+QByteArrayView FileMapping::view() const { return QByteArrayView(data(), mSize); }
+
+/*!
+ *  Returns a span of the mapped range.
+ *
+ *  The span is only valid while the range is mapped.
+ */
+std::span<const std::byte> FileMapping::bytes() const { return {reinterpret_cast<const std::byte*>(mData), static_cast<size_t>(mSize)}; }
+
+/*!
+ *  Unmaps the range, making the mapping null.
+ */
+void FileMapping::unmap()
+{
+    if(mData)
+        mFile->unmap(mData);
+
+    mFile = nullptr;
+    mData = nullptr;
+    mSize = 0;
+}
+
+/*!
+ *  Unmaps the range of this mapping and takes over the range mapped by @a other, which becomes null.
+ */
+FileMapping& FileMapping::operator=(FileMapping&& other)
+{
+    if(&other != this)
+    {
+        unmap();
+        mFile = std::exchange(other.mFile, nullptr);
+        mData = std::exchange(other.mData, nullptr);
+        mSize = std::exchange(other.mSize, 0);
+    }
+
+    return *this;
+}
+
+}
@@ -1,6 +1,9 @@
 // Unit Includes
 #include "qx/io/qx-filestreamwriter.h"
 
+// Standard Library Includes
+#include <algorithm>
+
 // Intra-component Includes
 #include "qx-common-io_p.h"
 
@@ -22,6 +25,31 @@ namespace Qx
  *
  *  The file on which to operate is specified as a path and the underlying handle is managed by the stream.
  *
+ *  @par Buffered Mode
+ *  By default, every write is passed to the file immediately and the stream's status is updated after each
+ *  one, which dominates the cost of writing many small values. When a buffer size is set with
+ *  setBufferSize(), the file is instead opened in buffered mode, in which writes are serialized into an
+ *  in-memory buffer that is only written to the file once it holds at least that many bytes. The status is
+ *  then only updated when the buffer is written, such that an error is reported by the first write or
+ *  flush() after the one that caused it, and all writes that follow an error are discarded.
+ *
+ *  If background flushing is also enabled with setBackgroundFlush(), a full buffer is handed off to a
+ *  separate thread to be written while writing continues into a second buffer, so that serialization and
+ *  file output overlap.
+ *
+ *  @code{.cpp}
+ *  Qx::FileStreamWriter writer(u"samples.bin"_s, Qx::Truncate);
+ *  writer.setBufferSize(4 * 1024 * 1024);
+ *  writer.setBackgroundFlush(true);
+ *  writer.openFile();
+ *
+ *  for(const Sample& s : samples)
+ *      writer << s.time << s.value;
+ *
+ *  if(writer.flush().isFailure())
+ *      qWarning() << writer.status().outcomeInfo();
+ *  @endcode
+ *
  *  @sa FileStreamReader and TextStreamWriter
  */
 
@@ -41,7 +69,10 @@ namespace Qx
 FileStreamWriter::FileStreamWriter(WriteMode writeMode, WriteOptions writeOptions) :
     mFile(nullptr),
     mWriteMode(writeMode),
-    mWriteOptions(writeOptions)
+    mWriteOptions(writeOptions),
+    mBufferSize(0),
+    mBackgroundFlush(false),
+    mHasher(nullptr)
 {
     // Map unsupported modes to supported ones
     if(mWriteMode == Insert)
@@ -62,8 +93,12 @@ FileStreamWriter::FileStreamWriter(WriteMode writeMode, WriteOptions writeOption
  *  @sa filePath() and setFilePath().
  */
 FileStreamWriter::FileStreamWriter(const QString& filePath, WriteMode writeMode, WriteOptions writeOptions) :
+    mFile(nullptr),
     mWriteMode(writeMode),
-    mWriteOptions(writeOptions)
+    mWriteOptions(writeOptions),
+    mBufferSize(0),
+    mBackgroundFlush(false),
+    mHasher(nullptr)
 {
     // Map unsupported modes to supported ones
     if(mWriteMode == Insert)
@@ -117,12 +152,72 @@ void FileStreamWriter::setFile(const QString& filePath)
 
 void FileStreamWriter::unsetFile()
 {
+    closeFile();
     if(mFile)
         delete mFile;
     mFile = nullptr;
     mStreamWriter.setDevice(mFile);
 }
 
+IoOpReport FileStreamWriter::writeBuffer(const QByteArray& data)
+{
+    qint64 written = mFile->write(data);
+    if(written == -1)
+        return IoOpReport(IO_OP_WRITE, FILE_DEV_ERR_MAP.value(mFile->error()), mFile);
+    else if(written != data.size())
+        return IoOpReport(IO_OP_WRITE, IO_ERR_FILE_SIZE_MISMATCH, mFile);
+
+    // Hash while the data is still in memory instead of reading it back later
+    if(mHasher)
+        mHasher->addData(data);
+
+    return IoOpReport(IO_OP_WRITE, IO_SUCCESS, mFile);
+}
+
+void FileStreamWriter::collectBackgroundFlush()
+{
+    if(mFlushPool)
+        mFlushPool->waitForDone();
+    if(!mBackStatus.isNull())
+    {
+        mStatus = mBackStatus;
+        mBackStatus = IoOpReport();
+    }
+}
+
+void FileStreamWriter::flushBuffer()
+{
+    // Only one buffer is written at a time, so the previous one must finish before its outcome is known
+    collectBackgroundFlush();
+    if(hasError())
+        return;
+
+    QByteArray& front = mBuffer->buffer();
+    if(mBackgroundFlush)
+    {
+        // Buffers are written one at a time, in order
+        if(!mFlushPool)
+        {
+            mFlushPool = std::make_unique<QThreadPool>();
+            mFlushPool->setMaxThreadCount(1);
+        }
+
+        // Swap buffers so that the full one can be written while the (emptied) other is filled
+        mBackBuffer.swap(front);
+        mFlushPool->start([this]{
+            mBackStatus = writeBuffer(mBackBuffer);
+            mBackBuffer.resize(0);
+        });
+    }
+    else
+    {
+        mStatus = writeBuffer(front);
+        front.resize(0); // Keeps capacity
+    }
+
+    mBuffer->seek(0);
+}
+
 //Public:
 /*!
  *  Returns the current byte order setting.
@@ -156,6 +251,9 @@ QDataStream::FloatingPointPrecision FileStreamWriter::floatingPointPrecision() c
  */
 void FileStreamWriter::resetStatus()
 {
+    if(mFlushPool)
+        mFlushPool->waitForDone();
+    mBackStatus = IoOpReport();
     mStatus = IoOpReport();
     mStreamWriter.resetStatus();
 }
@@ -188,6 +286,10 @@ void FileStreamWriter::setFloatingPointPrecision(QDataStream::FloatingPointPreci
  *
  *  The status is a report of the last write operation performed by FileStreamWriter. If no write operation has
  *  been performed since the stream was constructed or resetStatus() was last called the report will be null.
+ *
+ *  In buffered mode, the status is instead a report of the last time the buffer was written to the file.
+ *
+ *  @sa flush().
  */
 IoOpReport FileStreamWriter::status() const { return mStatus; }
 
@@ -201,6 +303,18 @@ IoOpReport FileStreamWriter::status() const { return mStatus; }
  */
 IoOpReport FileStreamWriter::writeRawData(const QByteArray& data)
 {
+    if(mBuffer)
+    {
+        if(!hasError())
+        {
+            mStreamWriter.writeRawData(data, data.size());
+            if(mBuffer->data().size() >= mBufferSize)
+                flushBuffer();
+        }
+
+        return mStatus;
+    }
+
     IoOpReport check = preWriteErrorCheck();
 
     if(check.isFailure())
@@ -261,6 +375,97 @@ void FileStreamWriter::setFilePath(const QString& filePath)
  */
 QString FileStreamWriter::filePath() const { return mFile ? mFile->fileName() : QString(); }
 
+/*!
+ *  Returns the size the write buffer must reach before it's written to the file, or @c 0 if buffered mode
+ *  is disabled.
+ *
+ *  @sa setBufferSize().
+ */
+qsizetype FileStreamWriter::bufferSize() const { return mBufferSize; }
+
+/*!
+ *  Sets the size the write buffer must reach before it's written to the file to @a size, where a value of
+ *  @c 0 disables buffered mode, which is the default.
+ *
+ *  Larger buffers mean fewer, larger writes, at the cost of memory and of data being held back for longer.
+ *  A buffer of a few megabytes is generally enough to make writing bound by the speed of the device.
+ *
+ *  Buffered mode is only entered or left when the file is opened, though changes to the size of an
+ *  active buffer take effect immediately. While in buffered mode, the file itself is opened without
+ *  Qt's own buffering.
+ *
+ *  @sa bufferSize() and setBackgroundFlush().
+ */
+void FileStreamWriter::setBufferSize(qsizetype size) { mBufferSize = std::max(size, qsizetype(0)); }
+
+/*!
+ *  Returns @c true if buffers are written to the file on a separate thread while in buffered mode;
+ *  otherwise, returns @c false.
+ *
+ *  @sa setBackgroundFlush().
+ */
+bool FileStreamWriter::backgroundFlush() const { return mBackgroundFlush; }
+
+/*!
+ *  Sets whether or not buffers are written to the file on a separate thread while in buffered mode to
+ *  @a enabled. This is disabled by default.
+ *
+ *  With background flushing, a full buffer is written while writing continues into a second buffer, so that
+ *  up to twice the buffer size is in use at once. Only one buffer is written at a time, so writing stalls
+ *  if the second buffer fills before the first has been written.
+ *
+ *  @sa backgroundFlush() and setBufferSize().
+ */
+void FileStreamWriter::setBackgroundFlush(bool enabled) { mBackgroundFlush = enabled; }
+
+/*!
+ *  Returns the hasher that is fed the data written to the file, or @c nullptr if none is set.
+ *
+ *  @sa setHasher().
+ */
+Hasher* FileStreamWriter::hasher() const { return mHasher; }
+
+/*!
+ *  Sets the hasher that is fed all data as it's written to the file to @a hasher, or unsets it if
+ *  @a hasher is @c nullptr, which is the default. The stream does not take ownership of the hasher,
+ *  which must outlive the file being open.
+ *
+ *  This allows the digest of a file to be obtained while it's written, without reading it back afterwards.
+ *  Only data that was actually written to the file is hashed, so the digest should only be relied on if
+ *  the stream has no error. In buffered mode, data is hashed as each buffer is written, so flush() should
+ *  be called before obtaining the result.
+ *
+ *  The hasher must be set before the file is opened. If buffered mode is not enabled, the stream instead
+ *  passes each write through a write buffer of size @c 0 so that the data can be observed, which makes
+ *  the status behave the same as it would without the hasher.
+ *
+ *  @sa hasher() and setBufferSize().
+ */
+void FileStreamWriter::setHasher(Hasher* hasher) { mHasher = hasher; }
+
+/*!
+ *  Writes any data held by the stream to the file, waits for it to be written, and returns the stream's
+ *  resulting status.
+ *
+ *  In buffered mode this writes out the buffer regardless of how full it is; otherwise, this flushes the
+ *  file's own buffer, if any. Nothing is written if the stream has an error.
+ *
+ *  @sa status().
+ */
+IoOpReport FileStreamWriter::flush()
+{
+    if(mBuffer)
+    {
+        if(!mBuffer->data().isEmpty())
+            flushBuffer();
+        collectBackgroundFlush();
+    }
+    else if(fileIsOpen() && !hasError() && !mFile->flush())
+        mStatus = IoOpReport(IO_OP_WRITE, FILE_DEV_ERR_MAP.value(mFile->error()), mFile);
+
+    return mStatus;
+}
+
 /*!
  *  Returns @c true if the stream's current status indicates that an error has occurred; otherwise, returns @c false.
  *
@@ -288,22 +493,44 @@ IoOpReport FileStreamWriter::openFile()
     // Attempt to open file
     QIODevice::OpenMode om = QIODevice::WriteOnly;
     om |= mWriteMode == Truncate ? QIODevice::Truncate : QIODevice::Append;
-    if(mWriteOptions.testFlag(Unbuffered))
+    if(mWriteOptions.testFlag(Unbuffered) || mBufferSize > 0)
         om |= QIODevice::Unbuffered;
 
     IoOpResultType openResult = parsedOpen(mFile, om);
     if(openResult != IO_SUCCESS)
         return IoOpReport(IO_OP_WRITE, openResult, mFile);
 
+    // Redirect the stream to the write buffer, which is also where data is hashed
+    if((mBufferSize > 0 || mHasher) && !mBuffer)
+    {
+        mBuffer = std::make_unique<QBuffer>();
+        mBuffer->buffer().reserve(mBufferSize);
+        mBuffer->open(QIODevice::WriteOnly);
+        mStreamWriter.setDevice(mBuffer.get());
+    }
+
     // Return no error
     return IoOpReport(IO_OP_WRITE, IO_SUCCESS, mFile);
 }
 
 /*!
  *  Closes the file associated with the file stream writer, if present.
+ *
+ *  In buffered mode, any buffered data is written to the file first.
+ *
+ *  @sa flush().
  */
 void FileStreamWriter::closeFile()
 {
+    if(mBuffer)
+    {
+        flush();
+        mStreamWriter.setDevice(mFile);
+        mBuffer.reset();
+        mFlushPool.reset();
+        mBackBuffer = QByteArray();
+    }
+
     if(mFile)
         mFile->close();
 }
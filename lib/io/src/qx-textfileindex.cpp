@@ -0,0 +1,305 @@
+// Unit Includes
+#include "qx/io/qx-textfileindex.h"
+
+// Standard Library Includes
+#include <cstring>
+
+// Qt Includes
+#include <QDataStream>
+#include <QDateTime>
+#include <QScopeGuard>
+#include <QStringConverter>
+
+// Intra-component Includes
+#include "qx/io/qx-common-io.h"
+#include "qx-common-io_p.h"
+
+namespace Qx
+{
+
+//===============================================================================================================
+// TextFileIndex
+//===============================================================================================================
+
+/*!
+ *  @class TextFileIndex qx/io/qx-textfileindex.h
+ *  @ingroup qx-io
+ *
+ *  @brief The TextFileIndex class records where each line of a text file begins, so that any line can be
+ *  accessed directly.
+ *
+ *  Functions that address text files by line, such as readTextFromFile(), normally need to read a file from
+ *  its beginning every time they're used in order to locate the requested line, which becomes prohibitive
+ *  for very large files that are accessed repeatedly. An index is built with a single pass over a file and
+ *  allows the byte offset of any line to be determined in constant time, using a little more than four bytes
+ *  per line.
+ *
+ *  An index remains valid for as long as the file's size and modification time are unchanged, which can be
+ *  checked with isCurrent(). Functions that accept an index fall back to reading the file normally if it's no
+ *  longer current, so a stale index is never used. Indices can be kept in memory, or saved to and loaded from
+ *  a sidecar file so that they persist between runs:
+ *
+ *  @code{.cpp}
+ *  QFile log(u"server.log"_s);
+ *  QFile logIndex(u"server.log.idx"_s);
+ *
+ *  Qx::TextFileIndex index;
+ *  Qx::TextFileIndex::buildCached(index, log, logIndex); // Only reads the whole log if it changed
+ *
+ *  QStringList page;
+ *  Qx::readTextFromFile(page, log, index, 5'000'000, 5'000'099);
+ *  @endcode
+ *
+ *  Indices can only be built for files that use an encoding compatible with ASCII, such as UTF-8. For other
+ *  files, such as those with a UTF-16 byte order mark, the resultant index is null.
+ *
+ *  @sa readTextFromFile().
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a null index.
+ */
+TextFileIndex::TextFileIndex() :
+    mNull(true),
+    mFileSize(0),
+    mLastModified(0),
+    mEndsWithBreak(false)
+{}
+
+//-Class Functions---------------------------------------------------------------------------------------------
+//Private:
+qint64 TextFileIndex::lastModified(const QFileInfo& fileInfo) { return fileInfo.lastModified().toMSecsSinceEpoch(); }
+
+//Public:
+/*!
+ *  Builds an index of @a textFile.
+ *
+ *  @param[out] returnBuffer The index of the file, which is null if the file's encoding is not supported.
+ *  @param[in] textFile The file to index.
+ *  @return A report containing details of operation success or failure.
+ */
+IoOpReport TextFileIndex::build(TextFileIndex& returnBuffer, QFile& textFile)
+{
+    // Reset return buffer
+    returnBuffer = TextFileIndex();
+
+    // Check file
+    QFileInfo fileInfo(textFile);
+    IoOpResultType fileCheckResult = fileCheck(fileInfo, Existance::Exist);
+    if(fileCheckResult != IO_SUCCESS)
+        return IoOpReport(IO_OP_ENUMERATE, fileCheckResult, textFile);
+
+    // Close file if it's already open
+    if(textFile.isOpen())
+        textFile.close();
+
+    // Attempt to open file
+    IoOpResultType openResult = parsedOpen(&textFile, QIODevice::ReadOnly | QIODevice::Unbuffered);
+    if(openResult != IO_SUCCESS)
+        return IoOpReport(IO_OP_ENUMERATE, openResult, textFile);
+
+    // Ensure file is closed upon return
+    QScopeGuard fileGuard([&textFile](){ textFile.close(); });
+
+    adviseSequentialRead(textFile);
+
+    // Find line breaks
+    TextFileIndex index;
+    index.mNull = false;
+    index.mLastModified = lastModified(fileInfo);
+
+    QByteArray buffer(READ_CHUNK_SIZE, Qt::Uninitialized);
+    qint64 offset = 0;
+    for(qint64 read; (read = textFile.read(buffer.data(), buffer.size())) != 0;)
+    {
+        if(read < 0)
+            return IoOpReport(IO_OP_ENUMERATE, IO_ERR_READ, textFile);
+
+        const char* data = buffer.constData();
+        const char* end = data + read;
+
+        if(offset == 0)
+        {
+            // Line breaks can only be found directly in ASCII compatible encodings
+            auto encoding = QStringConverter::encodingForData(QByteArrayView(data, read));
+            if(encoding && *encoding != QStringConverter::Utf8)
+                return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
+
+            index.appendLine(0);
+        }
+
+        for(const char* p = data; (p = static_cast<const char*>(std::memchr(p, '\n', end - p))); ++p)
+            index.appendLine(offset + (p - data) + 1);
+
+        offset += read;
+        index.mEndsWithBreak = *(end - 1) == '\n';
+    }
+    index.mFileSize = offset;
+
+    returnBuffer = std::move(index);
+    return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
+}
+
+/*!
+ *  Loads an index of @a textFile that was previously saved to @a indexFile.
+ *
+ *  @param[out] returnBuffer The index of the file, which is null if the saved index is no longer current.
+ *  @param[in] indexFile The file the index was saved to.
+ *  @param[in] textFile The file the index is of.
+ *  @return A report containing details of operation success or failure.
+ *
+ *  @sa save() and buildCached().
+ */
+IoOpReport TextFileIndex::load(TextFileIndex& returnBuffer, QFile& indexFile, const QFile& textFile)
+{
+    // Reset return buffer
+    returnBuffer = TextFileIndex();
+
+    // Read index
+    QByteArray data;
+    IoOpReport readReport = readBytesFromFile(data, indexFile);
+    if(readReport.isFailure())
+        return readReport;
+
+    // Parse index
+    TextFileIndex index;
+    quint32 magic;
+    quint16 version;
+
+    QDataStream in(data);
+    in >> magic >> version;
+    if(in.status() != QDataStream::Ok || magic != SIDECAR_MAGIC || version != SIDECAR_VERSION)
+        return IoOpReport(IO_OP_READ, IO_ERR_READ, indexFile);
+
+    in >> index.mFileSize >> index.mLastModified >> index.mEndsWithBreak >> index.mBlockOffsets >>
+          index.mLineOffsets >> index.mOverflowOffsets;
+
+    bool consistent = (index.mLineOffsets.size() + BLOCK_SIZE - 1) / BLOCK_SIZE == index.mBlockOffsets.size();
+    if(in.status() != QDataStream::Ok || !in.atEnd() || !consistent)
+        return IoOpReport(IO_OP_READ, IO_ERR_READ, indexFile);
+
+    index.mNull = false;
+
+    // Only use index if it still reflects the file
+    if(index.isCurrent(textFile))
+        returnBuffer = std::move(index);
+
+    return IoOpReport(IO_OP_READ, IO_SUCCESS, indexFile);
+}
+
+/*!
+ *  Loads the index of @a textFile from @a indexFile if it's current, or otherwise builds the index and
+ *  saves it to @a indexFile.
+ *
+ *  @param[out] returnBuffer The index of the file, which is null if the file's encoding is not supported.
+ *  @param[in] textFile The file to index.
+ *  @param[in] indexFile The file used to cache the index.
+ *  @return A report containing details of operation success or failure. If the index was built but could not
+ *  be saved, @a returnBuffer is still set and the report describes the write failure.
+ */
+IoOpReport TextFileIndex::buildCached(TextFileIndex& returnBuffer, QFile& textFile, QFile& indexFile)
+{
+    // Use cache if possible, any failure just means the index needs to be rebuilt
+    IoOpReport loadReport = load(returnBuffer, indexFile, textFile);
+    if(!loadReport.isFailure() && !returnBuffer.isNull())
+        return IoOpReport(IO_OP_ENUMERATE, IO_SUCCESS, textFile);
+
+    IoOpReport buildReport = build(returnBuffer, textFile);
+    if(buildReport.isFailure() || returnBuffer.isNull())
+        return buildReport;
+
+    IoOpReport saveReport = returnBuffer.save(indexFile);
+    return saveReport.isFailure() ? saveReport : buildReport;
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Private:
+void TextFileIndex::appendLine(qint64 offset)
+{
+    int line = mLineOffsets.size();
+    if(line % BLOCK_SIZE == 0)
+        mBlockOffsets.append(offset);
+
+    qint64 relative = offset - mBlockOffsets.back();
+    if(relative < OVERFLOW_OFFSET)
+        mLineOffsets.append(static_cast<quint32>(relative));
+    else
+    {
+        mLineOffsets.append(OVERFLOW_OFFSET);
+        mOverflowOffsets.insert(line, offset);
+    }
+}
+
+//Public:
+/*!
+ *  Returns @c true if the index is null; otherwise, returns @c false.
+ */
+bool TextFileIndex::isNull() const { return mNull; }
+
+/*!
+ *  Returns @c true if the index is not null and @a textFile has the same size and modification time as
+ *  it did when the index was built; otherwise, returns @c false.
+ */
+bool TextFileIndex::isCurrent(const QFile& textFile) const
+{
+    QFileInfo fileInfo(textFile);
+    return !mNull && fileInfo.exists() && fileInfo.size() == mFileSize && lastModified(fileInfo) == mLastModified;
+}
+
+/*!
+ *  Returns the size of the indexed file, in bytes.
+ */
+qint64 TextFileIndex::fileSize() const { return mFileSize; }
+
+/*!
+ *  Returns @c true if the indexed file ends with a line break; otherwise, returns @c false.
+ */
+bool TextFileIndex::endsWithBreak() const { return mEndsWithBreak; }
+
+/*!
+ *  Returns the number of lines in the indexed file, equivalent to the number of line breaks plus one.
+ *
+ *  If @a ignoreTrailingEmpty is @c true, the last line of the file is not counted if it's empty.
+ *
+ *  @sa textFileLineCount().
+ */
+int TextFileIndex::lineCount(bool ignoreTrailingEmpty) const
+{
+    int count = mLineOffsets.size();
+    return ignoreTrailingEmpty && mEndsWithBreak ? count - 1 : count;
+}
+
+/*!
+ *  Returns the byte offset within the indexed file at which line @a line begins, or @c -1 if the file
+ *  doesn't have that line.
+ */
+qint64 TextFileIndex::lineOffset(int line) const
+{
+    if(line < 0 || line >= mLineOffsets.size())
+        return -1;
+
+    quint32 relative = mLineOffsets[line];
+    return relative == OVERFLOW_OFFSET ? mOverflowOffsets.value(line) : mBlockOffsets[line / BLOCK_SIZE] + relative;
+}
+
+/*!
+ *  Saves the index to @a indexFile, replacing its contents, so that it can be restored later with load().
+ *
+ *  @return A report containing details of operation success or failure.
+ */
+IoOpReport TextFileIndex::save(QFile& indexFile) const
+{
+    if(mNull)
+        return IoOpReport(IO_OP_WRITE, IO_ERR_NULL, indexFile);
+
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out << SIDECAR_MAGIC << SIDECAR_VERSION << mFileSize << mLastModified << mEndsWithBreak << mBlockOffsets <<
+           mLineOffsets << mOverflowOffsets;
+
+    return writeBytesToFile(indexFile, data, Truncate, 0, CreatePath);
+}
+
+}
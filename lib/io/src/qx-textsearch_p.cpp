@@ -0,0 +1,636 @@
+// Unit Includes
+#include "qx-textsearch_p.h"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+// Qt Includes
+#include <QStringDecoder>
+
+namespace
+{
+
+constexpr qsizetype DECODE_CHUNK_SIZE = 64 * 1024;
+
+class HitCollector
+{
+private:
+    const Qx::TextQuery& mQuery;
+    QList<Qx::TextPos> mHits;
+    int mHitsSkipped;
+
+public:
+    explicit HitCollector(const Qx::TextQuery& query) :
+        mQuery(query),
+        mHitsSkipped(0)
+    {}
+
+    // Returns true if no more hits are needed
+    bool add(const Qx::TextPos& pos)
+    {
+        if(mHitsSkipped == mQuery.hitsToSkip())
+            mHits.append(pos);
+        else
+            ++mHitsSkipped;
+
+        return mHits.size() == mQuery.hitLimit();
+    }
+
+    QList<Qx::TextPos> hits() const { return mHits; }
+};
+
+qsizetype utf16Length(QByteArrayView utf8)
+{
+    // Avoid decoding when possible, since text is usually ASCII
+    if(std::all_of(utf8.cbegin(), utf8.cend(), [](char c){ return static_cast<uchar>(c) < 0x80; }))
+        return utf8.size();
+
+    return QString::fromUtf8(utf8).size();
+}
+
+qsizetype utf8Offset(QByteArrayView utf8, qsizetype utf16Units)
+{
+    // Byte offset of the given UTF-16 position, clamped to the end of the data
+    qsizetype i = 0;
+    for(qsizetype u = 0; u < utf16Units && i < utf8.size(); ++u)
+    {
+        uchar lead = static_cast<uchar>(utf8[i]);
+        if(lead >= 0xF0)
+        {
+            i += 4;
+            ++u; // Surrogate pair
+        }
+        else if(lead >= 0xE0)
+            i += 3;
+        else if(lead >= 0xC0)
+            i += 2;
+        else
+            i += 1;
+    }
+
+    return std::min(i, utf8.size());
+}
+
+QStringConverter::Encoding detectEncoding(QByteArrayView text)
+{
+    // Same detection as QTextStream, which defaults to UTF-8
+    return QStringConverter::encodingForData(text).value_or(QStringConverter::Utf8);
+}
+
+QList<int> textLayout(QByteArrayView text, bool ignoreTrailingEmpty)
+{
+    // Character count of each line, as textFileLayout() provides for a file
+    QList<int> layout;
+    int length = 0;
+    bool empty = true;
+    bool endsWithBreak = false;
+
+    QStringDecoder decoder(detectEncoding(text));
+    for(qsizetype offset = 0; offset < text.size(); offset += DECODE_CHUNK_SIZE)
+    {
+        QString chunk = decoder(text.sliced(offset, std::min(DECODE_CHUNK_SIZE, text.size() - offset)));
+        for(QChar c : std::as_const(chunk))
+        {
+            // Mimic Text mode
+            if(c == u'\r')
+                continue;
+
+            empty = false;
+            endsWithBreak = c == u'\n';
+            if(endsWithBreak)
+            {
+                layout.append(length);
+                length = 0;
+            }
+            else
+                ++length;
+        }
+    }
+
+    // Account for the final line, which is blank if the text ends with a break
+    if(!empty && (!endsWithBreak || !ignoreTrailingEmpty))
+        layout.append(length);
+
+    return layout;
+}
+
+bool isUtf8Eligible(QByteArrayView text, const Qx::TextQuery& query)
+{
+    /* Byte-wise matching is only equivalent to matching the decoded text when comparisons are exact, matches
+     * can't span line breaks they don't contain, and there are no carriage returns for Text mode to remove.
+     */
+    return query.caseSensitivity() == Qt::CaseSensitive && !query.allowSplit() &&
+           std::memchr(text.data(), '\r', text.size()) == nullptr;
+}
+
+QList<Qx::TextPos> searchUtf8(QByteArrayView text, const Qx::TextQuery& query, Qx::TextPos start)
+{
+    HitCollector collector(query);
+    const QByteArray needle = query.string().toUtf8();
+    const char* const end = text.data() + text.size();
+
+    // Locate start line
+    const char* cursor = text.data();
+    int line = 0;
+    for(; line != *start.line(); ++line)
+    {
+        auto nl = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+        if(!nl)
+            return {}; // Out of bounds
+        cursor = nl + 1;
+    }
+
+    // Locate start character, limited to the end of the line
+    auto lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+    QByteArrayView startLine(cursor, lineEnd ? lineEnd : end);
+    qsizetype startOffset = utf8Offset(startLine, *start.character());
+    int character = utf16Length(startLine.first(startOffset));
+    cursor += startOffset;
+
+    // Moves the cursor forward while tracking its text position
+    auto advance = [&](const char* target){
+        for(const char* nl; (nl = static_cast<const char*>(std::memchr(cursor, '\n', target - cursor)));)
+        {
+            ++line;
+            character = 0;
+            cursor = nl + 1;
+        }
+        character += utf16Length(QByteArrayView(cursor, target));
+        cursor = target;
+    };
+
+    // Search
+    std::boyer_moore_horspool_searcher searcher(needle.cbegin(), needle.cend());
+    while(cursor != end)
+    {
+        const char* hit = needle.size() == 1 ?
+                          static_cast<const char*>(std::memchr(cursor, needle.front(), end - cursor)) :
+                          std::search(cursor, end, searcher);
+        if(!hit || hit == end)
+            break;
+
+        advance(hit);
+        if(collector.add(Qx::TextPos(line, character)))
+            break;
+
+        // Resume after the match
+        advance(hit + needle.size());
+    }
+
+    return collector.hits();
+}
+
+QList<Qx::TextPos> searchDecoded(QByteArrayView text, QStringConverter::Encoding encoding, const Qx::TextQuery& query, Qx::TextPos start)
+{
+    HitCollector collector(query);
+    const bool caseInsensitive = query.caseSensitivity() == Qt::CaseInsensitive;
+    const bool allowSplit = query.allowSplit();
+
+    // Prepare pattern, folding per character to match Char::compare()
+    QString pattern = query.string();
+    if(caseInsensitive)
+        for(QChar& c : pattern)
+            c = c.toCaseFolded();
+
+    const qsizetype patternLength = pattern.size();
+    QList<qsizetype> failure(patternLength, 0);
+    for(qsizetype i = 1, k = 0; i < patternLength; ++i)
+    {
+        while(k > 0 && pattern[i] != pattern[k])
+            k = failure[k - 1];
+        if(pattern[i] == pattern[k])
+            ++k;
+        failure[i] = k;
+    }
+
+    /* Positions of the most recently matched characters (ring buffer), so that the position of the first
+     * character of a match is known once the match completes
+     */
+    QList<Qx::TextPos> matchedPositions(patternLength);
+    qsizetype matchedCount = 0;
+    qsizetype state = 0;
+
+    // Stream through the text
+    const int startLine = *start.line();
+    const int startCharacter = *start.character();
+    bool searching = startLine == 0 && startCharacter == 0;
+    int line = 0;
+    int character = 0;
+
+    QStringDecoder decoder(encoding);
+    for(qsizetype offset = 0; offset < text.size(); offset += DECODE_CHUNK_SIZE)
+    {
+        QString chunk = decoder(text.sliced(offset, std::min(DECODE_CHUNK_SIZE, text.size() - offset)));
+        for(QChar c : std::as_const(chunk))
+        {
+            // Mimic Text mode
+            if(c == u'\r')
+                continue;
+
+            // Wait for start position, which is limited to the end of its line
+            if(!searching && line == startLine && (character == startCharacter || c == u'\n'))
+                searching = true;
+
+            if(searching && !(allowSplit && c == u'\n' && pattern[state] != u'\n'))
+            {
+                Qx::TextPos pos(line, character);
+                matchedPositions[matchedCount++ % patternLength] = pos;
+
+                QChar fc = caseInsensitive ? c.toCaseFolded() : c;
+                while(state > 0 && pattern[state] != fc)
+                    state = failure[state - 1];
+                if(pattern[state] == fc)
+                    ++state;
+
+                if(state == patternLength)
+                {
+                    if(collector.add(matchedPositions[matchedCount % patternLength]))
+                        return collector.hits();
+
+                    state = 0; // Matches don't overlap
+                }
+            }
+
+            if(c == u'\n')
+            {
+                ++line;
+                character = 0;
+            }
+            else
+                ++character;
+        }
+    }
+
+    return collector.hits();
+}
+
+}
+
+namespace Qx
+{
+/*! @cond */
+
+//===============================================================================================================
+// FileBytes
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+FileBytes::FileBytes(QFile& file) :
+    mFile(file),
+    mMapping(nullptr),
+    mError(false)
+{
+    Q_ASSERT(file.isOpen());
+
+    qint64 size = file.size();
+    if(size > 0)
+        mMapping = file.map(0, size);
+
+    if(mMapping)
+        mData = QByteArrayView(mMapping, size);
+    else
+    {
+        // Fallback for files that cannot be mapped
+        file.unsetError();
+        mBuffer = file.readAll();
+        mError = file.error() != QFileDevice::NoError;
+        mData = mBuffer;
+    }
+}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+FileBytes::~FileBytes()
+{
+    if(mMapping)
+        mFile.unmap(mMapping);
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+bool FileBytes::hasError() const { return mError; }
+QByteArrayView FileBytes::data() const { return mData; }
+
+//===============================================================================================================
+// StringAutomaton
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+StringAutomaton::StringAutomaton() :
+    mNodes(1)
+{
+    mRootTable.fill(0);
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Private:
+qint32 StringAutomaton::edge(qint32 node, char16_t unit) const
+{
+    const QList<Edge>& edges = mNodes[node].edges;
+    auto itr = std::lower_bound(edges.cbegin(), edges.cend(), unit, [](const Edge& e, char16_t u){ return e.unit < u; });
+    return itr != edges.cend() && itr->unit == unit ? itr->target : -1;
+}
+
+//Public:
+void StringAutomaton::addPattern(QStringView pattern, qsizetype id)
+{
+    Q_ASSERT(!pattern.isEmpty());
+
+    qint32 node = 0;
+    for(QChar c : pattern)
+    {
+        char16_t unit = c.unicode();
+        QList<Edge>& edges = mNodes[node].edges;
+        auto itr = std::lower_bound(edges.begin(), edges.end(), unit, [](const Edge& e, char16_t u){ return e.unit < u; });
+        if(itr != edges.end() && itr->unit == unit)
+            node = itr->target;
+        else
+        {
+            qint32 child = mNodes.size();
+            edges.insert(itr, Edge{unit, child});
+            mNodes.emplaceBack();
+            node = child;
+        }
+    }
+
+    mNodes[node].patterns.append(id);
+}
+
+void StringAutomaton::build()
+{
+    // Root
+    for(const Edge& e : std::as_const(mNodes.front().edges))
+        if(e.unit < mRootTable.size())
+            mRootTable[e.unit] = e.target;
+
+    // Fail and dictionary links, breadth first so that shallower nodes are always complete
+    QList<qint32> queue;
+    for(const Edge& e : std::as_const(mNodes.front().edges))
+        queue.append(e.target);
+
+    for(qsizetype i = 0; i < queue.size(); ++i)
+    {
+        qint32 node = queue[i];
+        for(const Edge& e : std::as_const(mNodes[node].edges))
+        {
+            Node& child = mNodes[e.target];
+            child.fail = step(mNodes[node].fail, e.unit);
+
+            const Node& fail = mNodes[child.fail];
+            child.dictionary = !fail.patterns.isEmpty() ? child.fail : fail.dictionary;
+
+            queue.append(e.target);
+        }
+    }
+}
+
+bool StringAutomaton::isEmpty() const { return mNodes.size() == 1; }
+
+qint32 StringAutomaton::step(qint32 state, char16_t unit) const
+{
+    for(;;)
+    {
+        if(state == 0)
+            return unit < mRootTable.size() ? mRootTable[unit] : std::max(edge(0, unit), 0);
+
+        if(qint32 target = edge(state, unit); target != -1)
+            return target;
+
+        state = mNodes[state].fail;
+    }
+}
+
+//===============================================================================================================
+// TextQuerySet
+//===============================================================================================================
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+TextQuerySet::TextQuerySet(const QList<TextQuery>& queries) :
+    mQueries(queries)
+{
+    for(qsizetype id = 0; id < mQueries.size(); ++id)
+    {
+        const TextQuery& query = mQueries[id];
+        if(query.string().isEmpty() || query.hitLimit() == 0)
+            continue;
+
+        // Queries are grouped by how the text must be processed for them
+        bool caseInsensitive = query.caseSensitivity() == Qt::CaseInsensitive;
+        bool ignoreBreaks = query.allowSplit() && !query.string().contains(u'\n');
+        auto mode = std::find_if(mModes.begin(), mModes.end(), [&](const Mode& m){
+            return m.caseInsensitive == caseInsensitive && m.ignoreBreaks == ignoreBreaks;
+        });
+        if(mode == mModes.end())
+        {
+            mModes.append(Mode{.caseInsensitive = caseInsensitive, .ignoreBreaks = ignoreBreaks});
+            mode = std::prev(mModes.end());
+        }
+
+        // Fold per character to match Char::compare()
+        QString pattern = query.string();
+        if(caseInsensitive)
+            for(QChar& c : pattern)
+                c = c.toCaseFolded();
+
+        mode->automaton.addPattern(pattern, id);
+        mode->maxLength = std::max(mode->maxLength, pattern.size());
+    }
+
+    for(Mode& mode : mModes)
+        mode.automaton.build();
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+const QList<TextQuery>& TextQuerySet::queries() const { return mQueries; }
+
+QList<QList<TextPos>> TextQuerySet::search(QByteArrayView text, const QList<TextPos>& starts) const
+{
+    Q_ASSERT(starts.size() == mQueries.size());
+
+    struct QueryState
+    {
+        qint64 startIndex = std::numeric_limits<qint64>::max();
+        qint64 resumeIndex = 0;
+        int hitsSkipped = 0;
+        bool done = false;
+    };
+
+    struct Consumed
+    {
+        TextPos pos;
+        qint64 index;
+    };
+
+    struct ModeState
+    {
+        qint32 state = 0;
+        QList<Consumed> recent; // Ring buffer
+        qint64 count = 0;
+    };
+
+    const qsizetype queryCount = mQueries.size();
+    QList<QList<TextPos>> hits(queryCount);
+    QList<QueryState> queryStates(queryCount);
+
+    // Order active queries by start position
+    QList<qsizetype> startOrder;
+    for(qsizetype id = 0; id < queryCount; ++id)
+        if(!starts[id].isNull() && !mQueries[id].string().isEmpty() && mQueries[id].hitLimit() != 0)
+            startOrder.append(id);
+    std::stable_sort(startOrder.begin(), startOrder.end(), [&](qsizetype a, qsizetype b){ return starts[a] < starts[b]; });
+
+    qsizetype remaining = startOrder.size();
+    if(remaining == 0 || text.isEmpty())
+        return hits;
+
+    QList<ModeState> modeStates(mModes.size());
+    for(qsizetype m = 0; m < mModes.size(); ++m)
+        modeStates[m].recent.resize(mModes[m].maxLength);
+
+    // Stream through the text
+    qsizetype nextStart = 0;
+    qint64 index = 0;
+    int line = 0;
+    int character = 0;
+
+    QStringDecoder decoder(detectEncoding(text));
+    for(qsizetype offset = 0; offset < text.size(); offset += DECODE_CHUNK_SIZE)
+    {
+        QString chunk = decoder(text.sliced(offset, std::min(DECODE_CHUNK_SIZE, text.size() - offset)));
+        for(QChar c : std::as_const(chunk))
+        {
+            // Mimic Text mode
+            if(c == u'\r')
+                continue;
+
+            // Activate queries whose start has been reached, which is limited to the end of its line
+            for(; nextStart < startOrder.size(); ++nextStart)
+            {
+                const TextPos& start = starts[startOrder[nextStart]];
+                if(line < *start.line() || (line == *start.line() && character < *start.character() && c != u'\n'))
+                    break;
+                queryStates[startOrder[nextStart]].startIndex = index;
+            }
+
+            // Matches can't start before the earliest start
+            if(nextStart > 0)
+            {
+                for(qsizetype m = 0; m < mModes.size(); ++m)
+                {
+                    const Mode& mode = mModes[m];
+                    ModeState& ms = modeStates[m];
+                    if(mode.ignoreBreaks && c == u'\n')
+                        continue;
+
+                    ms.recent[ms.count++ % mode.maxLength] = Consumed{TextPos(line, character), index};
+                    ms.state = mode.automaton.step(ms.state, (mode.caseInsensitive ? c.toCaseFolded() : c).unicode());
+                    mode.automaton.forEachMatch(ms.state, [&](qsizetype id){
+                        QueryState& qs = queryStates[id];
+                        if(qs.done)
+                            return;
+
+                        const TextQuery& query = mQueries[id];
+                        const Consumed& first = ms.recent[(ms.count - query.string().size()) % mode.maxLength];
+                        if(first.index < qs.startIndex || first.index < qs.resumeIndex)
+                            return;
+
+                        // Matches of the same query don't overlap
+                        qs.resumeIndex = index + 1;
+
+                        if(qs.hitsSkipped == query.hitsToSkip())
+                            hits[id].append(first.pos);
+                        else
+                            ++qs.hitsSkipped;
+
+                        if(hits[id].size() == query.hitLimit())
+                        {
+                            qs.done = true;
+                            --remaining;
+                        }
+                    });
+                }
+
+                if(remaining == 0)
+                    return hits;
+            }
+
+            if(c == u'\n')
+            {
+                ++line;
+                character = 0;
+            }
+            else
+                ++character;
+
+            ++index;
+        }
+    }
+
+    return hits;
+}
+
+//===============================================================================================================
+// Functions
+//===============================================================================================================
+
+QList<TextPos> findStringInText(QByteArrayView text, const TextQuery& query, TextPos start)
+{
+    Q_ASSERT(!start.isNull() && !start.line().isLast() && !start.character().isLast());
+
+    if(query.hitLimit() == 0 || query.string().isEmpty() || text.isEmpty())
+        return {};
+
+    QStringConverter::Encoding encoding = detectEncoding(text);
+
+    if(encoding == QStringConverter::Utf8)
+    {
+        if(text.startsWith("\xEF\xBB\xBF"))
+            text = text.sliced(3); // Skip BOM
+
+        if(isUtf8Eligible(text, query))
+            return searchUtf8(text, query, start);
+    }
+
+    return searchDecoded(text, encoding, query, start);
+}
+
+void textAbsolutePosition(TextPos& textPos, QByteArrayView text, bool ignoreTrailingEmpty)
+{
+    // Do nothing if there is nothing to translate
+    if(textPos.isNull() || !(textPos.line().isLast() || textPos.character().isLast()))
+        return;
+
+    QList<int> layout = textLayout(text, ignoreTrailingEmpty);
+
+    // Null pos if text is empty
+    if(layout.isEmpty())
+    {
+        textPos = TextPos();
+        return;
+    }
+
+    // Translate line number
+    if(textPos.line().isLast())
+        textPos.setLine(layout.count() - 1);
+    else if(textPos.line() >= layout.count()) // Pos is OOB
+    {
+        textPos = TextPos();
+        return;
+    }
+
+    // Translate character number
+    if(textPos.character().isLast())
+        textPos.setCharacter(layout.value(*textPos.line()) - 1);
+    else if(textPos.character() > layout.value(*textPos.line()))
+        textPos.setCharacter(layout.value(*textPos.line())); // Set to line end so that \n is still included
+}
+
+/*! @endcond */
+}
@@ -0,0 +1,116 @@
+#ifndef QX_TEXTSEARCH_P_H
+#define QX_TEXTSEARCH_P_H
+
+// Standard Library Includes
+#include <array>
+
+// Qt Includes
+#include <QFile>
+#include <QList>
+
+// Intra-component Includes
+#include "qx/io/qx-textpos.h"
+#include "qx/io/qx-textquery.h"
+
+namespace Qx
+{
+/*! @cond */
+
+// Provides the complete contents of an open file, mapped into memory if possible
+class FileBytes
+{
+    Q_DISABLE_COPY_MOVE(FileBytes);
+private:
+    QFile& mFile;
+    uchar* mMapping;
+    QByteArray mBuffer;
+    QByteArrayView mData;
+    bool mError;
+
+public:
+    explicit FileBytes(QFile& file);
+    ~FileBytes();
+
+    bool hasError() const;
+    QByteArrayView data() const;
+};
+
+// Aho-Corasick automaton over UTF-16 code units
+class StringAutomaton
+{
+private:
+    struct Edge
+    {
+        char16_t unit;
+        qint32 target;
+    };
+
+    struct Node
+    {
+        QList<Edge> edges; // Sorted by unit
+        qint32 fail = 0;
+        qint32 dictionary = -1; // Nearest node along the fail chain that completes a pattern
+        QList<qsizetype> patterns;
+    };
+
+    QList<Node> mNodes;
+    std::array<qint32, 256> mRootTable; // Dense transitions from the root, which are the most common
+
+    qint32 edge(qint32 node, char16_t unit) const;
+
+public:
+    StringAutomaton();
+
+    void addPattern(QStringView pattern, qsizetype id);
+    void build();
+    bool isEmpty() const;
+
+    qint32 step(qint32 state, char16_t unit) const;
+
+    template<typename F>
+    void forEachMatch(qint32 state, F&& f) const
+    {
+        for(qint32 n = mNodes[state].patterns.isEmpty() ? mNodes[state].dictionary : state; n != -1; n = mNodes[n].dictionary)
+            for(qsizetype id : mNodes[n].patterns)
+                f(id);
+    }
+};
+
+// A set of queries that are searched for simultaneously in a single pass
+class TextQuerySet
+{
+private:
+    struct Mode
+    {
+        StringAutomaton automaton;
+        bool caseInsensitive;
+        bool ignoreBreaks;
+        qsizetype maxLength = 0;
+    };
+
+    QList<TextQuery> mQueries;
+    QList<Mode> mModes;
+
+public:
+    explicit TextQuerySet(const QList<TextQuery>& queries);
+
+    const QList<TextQuery>& queries() const;
+
+    // Starts must be absolute, one per query (a null start disables a query)
+    QList<QList<TextPos>> search(QByteArrayView text, const QList<TextPos>& starts) const;
+};
+
+/* Searches encoded text (as it would be read by a QTextStream from a file opened in Text mode) for
+ * query, beginning at start, which must be absolute.
+ */
+QList<TextPos> findStringInText(QByteArrayView text, const TextQuery& query, TextPos start);
+
+/* Converts any relative component of textPos to an absolute one for encoded text, as textFileAbsolutePosition()
+ * does for a file, so that a file that's already in memory doesn't need to be read again.
+ */
+void textAbsolutePosition(TextPos& textPos, QByteArrayView text, bool ignoreTrailingEmpty);
+
+/*! @endcond */
+}
+
+#endif // QX_TEXTSEARCH_P_H
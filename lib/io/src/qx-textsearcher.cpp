@@ -0,0 +1,237 @@
+// Unit Includes
+#include "qx/io/qx-textsearcher.h"
+
+// Standard Library Includes
+#include <algorithm>
+
+// Qt Includes
+#include <QFileInfo>
+#include <QScopeGuard>
+
+// Intra-component Includes
+#include "qx-common-io_p.h"
+#include "qx-textsearch_p.h"
+
+namespace Qx
+{
+
+//===============================================================================================================
+// TextSearcher::Result
+//===============================================================================================================
+
+/*!
+ *  @class TextSearcher::Result qx/io/qx-textsearcher.h
+ *
+ *  @brief The Result class holds the outcome of searching a single file with a TextSearcher.
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Private:
+TextSearcher::Result::Result(const QString& filePath, const QList<QList<TextPos>>& hits, const IoOpReport& report) :
+    mFilePath(filePath),
+    mHits(hits),
+    mReport(report)
+{}
+
+//Public:
+/*!
+ *  Constructs a null result.
+ */
+TextSearcher::Result::Result() {}
+
+//-Instance Functions--------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the path of the file that was searched.
+ */
+QString TextSearcher::Result::filePath() const { return mFilePath; }
+
+/*!
+ *  Returns the positions at which the query at index @a queryIndex of the searcher's queries was found
+ *  within the file.
+ */
+QList<TextPos> TextSearcher::Result::hits(qsizetype queryIndex) const { return mHits.value(queryIndex); }
+
+/*!
+ *  Returns @c true if any of the searcher's queries were found within the file; otherwise, returns @c false.
+ */
+bool TextSearcher::Result::hasHits() const
+{
+    return std::any_of(mHits.cbegin(), mHits.cend(), [](const QList<TextPos>& h){ return !h.isEmpty(); });
+}
+
+/*!
+ *  Returns a report detailing the success or failure of searching the file.
+ */
+IoOpReport TextSearcher::Result::report() const { return mReport; }
+
+/*!
+ *  Returns @c true if the file could not be searched; otherwise, returns @c false.
+ *
+ *  This is equivalent to <tt>report().isFailure()</tt>.
+ */
+bool TextSearcher::Result::isFailure() const { return mReport.isFailure(); }
+
+//===============================================================================================================
+// TextSearcher
+//===============================================================================================================
+
+/*!
+ *  @class TextSearcher qx/io/qx-textsearcher.h
+ *  @ingroup qx-io
+ *
+ *  @brief The TextSearcher class searches many text files for several queries at once.
+ *
+ *  Searching a large number of files for multiple strings with findStringInFile() requires opening and
+ *  reading every file once per query. A text searcher instead combines all of its queries into a single
+ *  automaton so that each file is only read and scanned once, no matter how many queries there are, and
+ *  searches files concurrently on its own thread pool.
+ *
+ *  All options of each TextQuery are respected, with results matching those of findStringInFile(), except
+ *  that TextQuery::allowSplit() has no effect for queries that themselves contain a line break.
+ *
+ *  Results are delivered through a QFuture, with the result for each file being made available as soon as
+ *  that file has been searched, at the same index as the file in the list that was provided. The hits for
+ *  each query are accessed by the query's index:
+ *
+ *  @code{.cpp}
+ *  Qx::TextSearcher searcher({Qx::TextQuery(u"TODO"_s), Qx::TextQuery(u"FIXME"_s, Qt::CaseInsensitive)});
+ *
+ *  QDirIterator itr(sourceDir, {u"*.cpp"_s, u"*.h"_s}, QDir::Files, QDirIterator::Subdirectories);
+ *  QFuture<Qx::TextSearcher::Result> future = searcher.search(itr);
+ *
+ *  for(const Qx::TextSearcher::Result& r : future.results())
+ *      for(const Qx::TextPos& pos : r.hits(1))
+ *          qDebug() << r.filePath() << *pos.line();
+ *  @endcode
+ *
+ *  Canceling the future skips any files that have not yet been started.
+ *
+ *  @sa findStringInFile().
+ */
+
+//-Constructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Constructs a text searcher that searches for @a queries, parsing files according to @a readOptions, with
+ *  at most @a maxThreadCount files being searched at once.
+ */
+TextSearcher::TextSearcher(const QList<TextQuery>& queries, ReadOptions readOptions, int maxThreadCount) :
+    mQuerySet(std::make_unique<TextQuerySet>(queries)),
+    mReadOptions(readOptions)
+{
+    setMaxThreadCount(maxThreadCount);
+}
+
+//-Destructor--------------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Destroys the text searcher, after waiting for all files that are being searched to finish.
+ */
+TextSearcher::~TextSearcher() { mPool.waitForDone(); }
+
+//-Class Functions---------------------------------------------------------------------------------------------
+//Private:
+TextSearcher::Result TextSearcher::searchFile(const QString& filePath, const TextQuerySet& querySet, ReadOptions readOptions)
+{
+    QFile file(filePath);
+
+    // Check file
+    QFileInfo fileInfo(file);
+    IoOpResultType fileCheckResult = fileCheck(fileInfo, Existance::Exist);
+    if(fileCheckResult != IO_SUCCESS)
+        return Result(filePath, {}, IoOpReport(IO_OP_INSPECT, fileCheckResult, file));
+
+    // Attempt to open file
+    IoOpResultType openResult = parsedOpen(&file, QIODevice::ReadOnly);
+    if(openResult != IO_SUCCESS)
+        return Result(filePath, {}, IoOpReport(IO_OP_INSPECT, openResult, file));
+
+    // Ensure file is closed upon return
+    QScopeGuard fileGuard([&file](){ file.close(); });
+
+    adviseSequentialRead(file);
+
+    // Search
+    FileBytes fileBytes(file);
+    if(fileBytes.hasError())
+        return Result(filePath, {}, IoOpReport(IO_OP_INSPECT, IO_ERR_READ, file));
+
+    // Translate start positions to absolute positions using the contents that are already in memory
+    QList<TextPos> starts;
+    for(const TextQuery& query : querySet.queries())
+    {
+        TextPos start = query.startPosition();
+        textAbsolutePosition(start, fileBytes.data(), readOptions.testFlag(IgnoreTrailingBreak));
+        starts.append(start);
+    }
+
+    return Result(filePath, querySet.search(fileBytes.data(), starts), IoOpReport(IO_OP_INSPECT, IO_SUCCESS, file));
+}
+
+//-Instance Functions------------------------------------------------------------------------------------------
+//Public:
+/*!
+ *  Returns the queries the searcher searches for.
+ */
+QList<TextQuery> TextSearcher::queries() const { return mQuerySet->queries(); }
+
+/*!
+ *  Returns the options that modify how files are parsed.
+ */
+ReadOptions TextSearcher::readOptions() const { return mReadOptions; }
+
+/*!
+ *  Returns the maximum number of files that are searched at once.
+ */
+int TextSearcher::maxThreadCount() const { return mPool.maxThreadCount(); }
+
+/*!
+ *  Sets the maximum number of files that are searched at once to @a maxThreadCount, which is raised
+ *  to @c 1 if it's lower.
+ */
+void TextSearcher::setMaxThreadCount(int maxThreadCount) { mPool.setMaxThreadCount(std::max(maxThreadCount, 1)); }
+
+/*!
+ *  Starts searching each file in @a filePaths and returns a future through which the results can be accessed.
+ *
+ *  The result for the file at index @c i in @a filePaths is reported at index @c i of the future. The
+ *  future's progress value is the number of files that have been processed.
+ */
+QFuture<TextSearcher::Result> TextSearcher::search(const QStringList& filePaths)
+{
+    // The query set outlives all jobs since the pool is drained on destruction
+    const TextQuerySet* querySet = mQuerySet.get();
+
+    return processFiles<Result>(mPool, filePaths, [querySet, readOptions = mReadOptions](const QString& filePath){
+        return searchFile(filePath, *querySet, readOptions);
+    });
+}
+
+/*!
+ *  @overload
+ *
+ *  Starts searching each file produced by @a iterator and returns a future through which the results can
+ *  be accessed. Entries of the iterator that are not files are ignored.
+ *
+ *  The iterator is exhausted before this function returns.
+ */
+QFuture<TextSearcher::Result> TextSearcher::search(QDirIterator& iterator)
+{
+    QStringList filePaths;
+    while(iterator.hasNext())
+    {
+        iterator.next();
+        if(iterator.fileInfo().isFile())
+            filePaths.append(iterator.filePath());
+    }
+
+    return search(filePaths);
+}
+
+/*!
+ *  Blocks until all files that have been submitted to the searcher have been searched.
+ */
+void TextSearcher::waitForDone() { mPool.waitForDone(); }
+
+}
@@ -17,6 +17,7 @@
 // Extra-component Includes
 #include "qx/core/qx-error.h"
 #include "qx/core/qx-cumulation.h"
+#include "qx/core/qx-integrity.h"
 #include "qx/io/qx-filestreamwriter.h"
 
 /* TODO: Try to improve efficiency like making uses of DownloadTask in hashes and the like pointers instead,
@@ -56,7 +57,7 @@ private:
     {
     private:
         FileStreamWriter mFsw;
-        std::optional<QCryptographicHash> mHash;
+        std::optional<Hasher> mHash;
 
     public:
         Writer(const QString& d, WriteOptions o, std::optional<QCryptographicHash::Algorithm> a);
@@ -18,17 +18,18 @@ namespace Qx
 //===============================================================================================================
 
 AsyncDownloadManager::Writer::Writer(const QString& d, WriteOptions o, std::optional<QCryptographicHash::Algorithm> a) :
-    mFsw(d, WriteMode::Truncate, o),
-    mHash(a ? std::optional<QCryptographicHash>(a.value()) : std::nullopt)
-{}
-
-IoOpReport AsyncDownloadManager::Writer::open() { return mFsw.openFile(); }
-IoOpReport AsyncDownloadManager::Writer::write(const QByteArray& d)
+    mFsw(d, WriteMode::Truncate, o)
 {
-    if(mHash)
-        mHash.value().addData(d);
-    return mFsw.writeRawData(d);
+    // The stream feeds the hash only the data that actually made it to the file
+    if(a)
+    {
+        mHash.emplace(a.value());
+        mFsw.setHasher(&mHash.value());
+    }
 }
+
+IoOpReport AsyncDownloadManager::Writer::open() { return mFsw.openFile(); }
+IoOpReport AsyncDownloadManager::Writer::write(const QByteArray& d) { return mFsw.writeRawData(d); }
 void AsyncDownloadManager::Writer::close() { mFsw.closeFile(); }
 bool AsyncDownloadManager::Writer::isOpen() const { return mFsw.fileIsOpen(); }
 QString AsyncDownloadManager::Writer::path() const { return mFsw.filePath(); }
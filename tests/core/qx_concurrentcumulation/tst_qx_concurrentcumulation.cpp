@@ -0,0 +1,92 @@
+// Standard Library Includes
+#include <thread>
+#include <vector>
+
+// Qt Includes
+#include <QtTest>
+
+// Qx Includes
+#include <qx/core/qx-concurrentcumulation.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+class tst_qx_concurrentcumulation : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_concurrentcumulation();
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void concurrentIncrease_data();
+    void concurrentIncrease();
+};
+
+// Setup
+tst_qx_concurrentcumulation::tst_qx_concurrentcumulation() {}
+
+// Cases
+void tst_qx_concurrentcumulation::concurrentIncrease_data()
+{
+    QTest::addColumn<int>("shards");
+    QTest::newRow("One shard") << 1;
+    QTest::newRow("Fewer shards than threads") << 3;
+    QTest::newRow("More shards than threads") << 16;
+}
+
+void tst_qx_concurrentcumulation::concurrentIncrease()
+{
+    QFETCH(int, shards);
+
+    static constexpr int THREADS = 8;
+    static constexpr int ITERATIONS = 20000;
+
+    Qx::ConcurrentCumulation<int, qint64> cm(shards);
+    auto shared = cm.insert(-1, 0, 2);
+    QList<Qx::ConcurrentCumulation<int, qint64>::Handle> own;
+    for(int t = 0; t < THREADS; t++)
+        own.append(cm.insert(t, 0, t + 1));
+
+    // Every thread hammers its own component and one shared by all
+    std::vector<std::thread> threads;
+    for(int t = 0; t < THREADS; t++)
+    {
+        threads.emplace_back([&, t]{
+            for(int i = 0; i < ITERATIONS; i++)
+            {
+                cm.increase(own.at(t), 1);
+                cm.increase(shared, 3);
+                if(i % 2)
+                    cm.reduce(shared, 1);
+            }
+        });
+    }
+
+    for(std::thread& th : threads)
+        th.join();
+
+    // Shared: (3 * ITERATIONS - ITERATIONS / 2) per thread, at a scalar of 2
+    qint64 sharedValue = qint64(THREADS) * (3 * ITERATIONS - ITERATIONS / 2);
+    QCOMPARE(cm.value(shared), sharedValue);
+
+    qint64 expected = sharedValue * 2;
+    for(int t = 0; t < THREADS; t++)
+    {
+        QCOMPARE(cm.value(own.at(t)), qint64(ITERATIONS));
+        expected += qint64(ITERATIONS) * (t + 1);
+    }
+
+    QCOMPARE(cm.total(), expected);
+}
+
+QTEST_APPLESS_MAIN(tst_qx_concurrentcumulation)
+#include "tst_qx_concurrentcumulation.moc"
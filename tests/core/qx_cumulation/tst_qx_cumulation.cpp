@@ -0,0 +1,166 @@
+// Standard Library Includes
+#include <utility>
+#include <vector>
+
+// Qt Includes
+#include <QtTest>
+
+// Qx Includes
+#include <qx/core/qx-cumulation.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+using namespace Qt::Literals::StringLiterals;
+
+class tst_qx_cumulation : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_cumulation();
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void handlesSurviveGrowth();
+    void removedHandleStaysStale();
+    void clearInvalidatesHandles();
+    void applyDeltas();
+};
+
+// Setup
+tst_qx_cumulation::tst_qx_cumulation() {}
+
+// Cases
+void tst_qx_cumulation::handlesSurviveGrowth()
+{
+    Qx::Cumulation<int, int> cm;
+    auto first = cm.insert(0, 5, 2);
+
+    // Enough components to rehash the index several times over, with removals mixed in
+    QList<Qx::Cumulation<int, int>::Handle> handles;
+    for(int i = 1; i < 200; i++)
+    {
+        handles.append(cm.insert(i, i));
+        if(i % 3 == 0)
+            cm.remove(i - 1);
+    }
+
+    QVERIFY(cm.contains(first));
+    QCOMPARE(cm.value(first), 5);
+    cm.increase(first, 1);
+    QCOMPARE(cm.value(0), 6);
+
+    int total = 12;
+    for(int i = 1; i < 200; i++)
+    {
+        const auto& h = handles.at(i - 1);
+        bool removed = (i + 1) % 3 == 0 && i + 1 < 200;
+        QCOMPARE(cm.contains(h), !removed);
+        if(!removed)
+        {
+            QCOMPARE(cm.value(h), i);
+            total += i;
+        }
+    }
+    QCOMPARE(cm.total(), total);
+}
+
+void tst_qx_cumulation::removedHandleStaysStale()
+{
+    Qx::Cumulation<QString, int> cm;
+    auto a = cm.insert(u"a"_s, 1, 10);
+    auto b = cm.insert(u"b"_s, 2);
+    QCOMPARE(cm.total(), 12);
+
+    // Removing takes the component's share of the total with it
+    cm.remove(a);
+    QVERIFY(!cm.contains(a));
+    QVERIFY(!cm.contains(u"a"_s));
+    QCOMPARE(cm.total(), 2);
+
+    // A new component reuses the freed storage, but not the old handle
+    auto c = cm.insert(u"c"_s, 3);
+    QVERIFY(c != a);
+    QVERIFY(!cm.contains(a));
+    QVERIFY(cm.contains(c));
+    QCOMPARE(cm.value(c), 3);
+    QCOMPARE(cm.total(), 5);
+
+    // Including when the same key comes back, which also starts over with a scalar of 1
+    cm.remove(c);
+    auto a2 = cm.increment(u"a"_s);
+    QCOMPARE(a2, 3);
+    QVERIFY(!cm.contains(a));
+    QVERIFY(!cm.contains(c));
+    QVERIFY(cm.handle(u"a"_s) != a);
+    QCOMPARE(cm.value(u"a"_s), 1);
+
+    // Unaffected handles still work
+    QVERIFY(cm.contains(b));
+    cm.setScalar(b, 3);
+    QCOMPARE(cm.total(), 7);
+
+    // Null handles are never contained
+    QVERIFY(!cm.contains(Qx::Cumulation<QString, int>::Handle()));
+    QVERIFY(!cm.handle(u"z"_s).isValid());
+}
+
+void tst_qx_cumulation::clearInvalidatesHandles()
+{
+    Qx::Cumulation<int, int> cm;
+    auto h = cm.insert(1, 1);
+    cm.clear();
+    QVERIFY(!cm.contains(h));
+    QCOMPARE(cm.total(), 0);
+
+    // The same key lands in the same storage after a clear, but is still a different component
+    auto h2 = cm.insert(1, 4);
+    QVERIFY(h2 != h);
+    QVERIFY(!cm.contains(h));
+    QVERIFY(cm.contains(h2));
+    QCOMPARE(cm.total(), 4);
+}
+
+void tst_qx_cumulation::applyDeltas()
+{
+    Qx::Cumulation<int, int> cm;
+    cm.insert(1, 10, 2);
+    cm.insert(2, 5);
+    cm.insert(3, 7);
+    cm.remove(3); // Leave a free entry behind to be reused
+
+    // Existing, new, and repeated components
+    std::vector<std::pair<int, int>> deltas{{1, 3}, {4, 2}, {2, -5}, {4, 1}, {5, 6}, {1, -1}};
+    cm.applyDeltas(deltas);
+
+    // Must match applying each delta individually
+    Qx::Cumulation<int, int> expected;
+    expected.insert(1, 10, 2);
+    expected.insert(2, 5);
+    for(const auto& [component, amount] : deltas)
+        expected.increase(component, amount);
+
+    QVERIFY(cm == expected);
+    QCOMPARE(cm.total(), 2 * 12 + 0 + 3 + 6);
+    QCOMPARE(cm.value(1), 12);
+    QCOMPARE(cm.value(2), 0);
+    QCOMPARE(cm.value(4), 3);
+    QCOMPARE(cm.value(5), 6);
+    QCOMPARE(cm.count(), 4);
+    QVERIFY(!cm.contains(3));
+
+    // Nothing to apply
+    cm.applyDeltas({});
+    QVERIFY(cm == expected);
+}
+
+QTEST_APPLESS_MAIN(tst_qx_cumulation)
+#include "tst_qx_cumulation.moc"
@@ -0,0 +1,282 @@
+// Standard Library Includes
+#include <cstring>
+
+// Qt Includes
+#include <QtTest>
+#include <QThread>
+
+// Qx Includes
+#include <qx/core/qx-dsvtable.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+class TrickleDevice : public QIODevice
+{
+    // Sequential device whose data is provided piecemeal by the test, and that otherwise stalls until ended
+private:
+    QByteArray mData;
+    bool mEnded = false;
+
+public:
+    TrickleDevice() { open(QIODevice::ReadOnly | QIODevice::Unbuffered); }
+
+    void provide(const QByteArray& data) { mData.append(data); }
+    void end() { mEnded = true; }
+
+    bool isSequential() const override { return true; }
+    qint64 bytesAvailable() const override { return mData.size() + QIODevice::bytesAvailable(); }
+
+    bool waitForReadyRead(int msecs) override
+    {
+        if(!mData.isEmpty())
+            return true;
+
+        if(!mEnded && msecs > 0)
+            QThread::msleep(msecs);
+        return false;
+    }
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override
+    {
+        qint64 size = std::min(maxSize, qint64(mData.size()));
+        std::memcpy(data, mData.constData(), size);
+        mData.remove(0, size);
+        return size;
+    }
+
+    qint64 writeData(const char*, qint64) override { return -1; }
+};
+
+using namespace Qt::Literals::StringLiterals;
+
+// Substitutes for the special characters that aren't ASCII, and so make fromDsv() use the stream parser
+const QChar STREAM_DELIM = u'\u00A7';
+const QChar STREAM_ESC = u'\u00B6';
+
+QByteArray toStreamParsed(const QByteArray& dsv, QChar delim, QChar esc)
+{
+    // ASCII bytes never occur within a multi-byte UTF-8 sequence, so the specials can be replaced bytewise
+    QByteArray substituted;
+    for(char c : dsv)
+    {
+        if(c == delim.toLatin1())
+            substituted += QString(STREAM_DELIM).toUtf8();
+        else if(c == esc.toLatin1())
+            substituted += QString(STREAM_ESC).toUtf8();
+        else
+            substituted += c;
+    }
+
+    return substituted;
+}
+
+qsizetype toStreamOffset(const QByteArray& dsv, qsizetype offset, QChar delim, QChar esc)
+{
+    // Each substitute is one byte longer than the character it replaced
+    qsizetype specials = 0;
+    for(char c : dsv.first(offset))
+        if(c == delim.toLatin1() || c == esc.toLatin1())
+            specials++;
+
+    return offset + specials;
+}
+
+class tst_qx_dsvtable : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_dsvtable();
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void byteParserMatchesStreamParser_data();
+    void byteParserMatchesStreamParser();
+    void finalRow_data();
+    void finalRow();
+    void readerResumesAfterStall();
+    void typedStopsAtTypeMismatch();
+};
+
+// Setup
+tst_qx_dsvtable::tst_qx_dsvtable() {}
+
+// Cases
+void tst_qx_dsvtable::byteParserMatchesStreamParser_data()
+{
+    QTest::addColumn<QByteArray>("dsv");
+    QTest::addColumn<QChar>("delim");
+    QTest::addColumn<QChar>("esc");
+    QTest::addColumn<Qx::DsvParseError::ParseError>("error");
+
+    using E = Qx::DsvParseError;
+
+    // Pads the data so that the character after the padding lands on the byte parser's 64 byte block boundary
+    auto atBoundary = [](qsizetype lead, const QByteArray& before, const QByteArray& after) {
+        return before + QByteArray(64 - lead - before.size(), 'x') + after;
+    };
+
+    // Basics
+    QTest::newRow("Empty") << QByteArray() << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Plain") << QByteArray("a,b\nc,d\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("No trailing newline") << QByteArray("a,b\nc,d") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Empty fields") << QByteArray(",\n,\n,") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Other specials") << QByteArray("'a;b';c\nd;'e''f'\n") << QChar(';') << QChar('\'') << E::NoError;
+
+    // Escaping
+    QTest::newRow("Quoted delimiter") << QByteArray("\"a,b\",c\n\",\",\",,\"\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Quoted newline") << QByteArray("\"a\nb\",c\nd,\"\n\"\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Doubled quotes") << QByteArray("\"a\"\"b\",\"c\"\"\"\ne,d\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Quoted final field") << QByteArray("a,\"b\"") << QChar(',') << QChar('"') << E::NoError;
+
+    // Line endings
+    QTest::newRow("CRLF") << QByteArray("a,b\r\nc,d\r\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("CRLF in quoted field") << QByteArray("\"a\r\nb\",c\r\nd,e") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Lone CR") << QByteArray("a\rb,c\n") << QChar(',') << QChar('"') << E::NoError;
+
+    // Encoding
+    QTest::newRow("UTF-8 BOM") << QByteArray("\xEF\xBB\xBF" "a,b\nc,d\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Multi-byte") << QByteArray("\xC3\xA9,\xC3\xBC\n\xE6\x97\xA5\xE6\x9C\xAC,\"\xE8\xAA\x9E,\"\n") << QChar(',') << QChar('"') << E::NoError;
+
+    // Errors
+    QTest::newRow("Illegal escape in field") << QByteArray("a,b\nc\"d,e\n") << QChar(',') << QChar('"') << E::IllegalEscape;
+    QTest::newRow("Illegal escape after field") << QByteArray("a,b\n\"c\"d,e\n") << QChar(',') << QChar('"') << E::IllegalEscape;
+    QTest::newRow("Illegal escape before multi-byte") << QByteArray("a,b\n\"c\"\xE6\x97\xA5,e\n") << QChar(',') << QChar('"') << E::IllegalEscape;
+    QTest::newRow("Unterminated field") << QByteArray("a,b\nc,\"d\n") << QChar(',') << QChar('"') << E::UnterminatedField;
+    QTest::newRow("Long row") << QByteArray("a,b\nc,d,e\n") << QChar(',') << QChar('"') << E::UnevenColumns;
+    QTest::newRow("Short row") << QByteArray("a,b\nc\nd,e\n") << QChar(',') << QChar('"') << E::UnevenColumns;
+    QTest::newRow("Short final row") << QByteArray("a,b\nc") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Long final row") << QByteArray("a,b\nc,d,e") << QChar(',') << QChar('"') << E::UnevenColumns;
+    QTest::newRow("Error after BOM") << QByteArray("\xEF\xBB\xBF" "a,b\nc\n") << QChar(',') << QChar('"') << E::UnevenColumns;
+    QTest::newRow("Error after CRLF") << QByteArray("a,b\r\nc\r\n") << QChar(',') << QChar('"') << E::UnevenColumns;
+    QTest::newRow("Error after multi-byte") << QByteArray("\xC3\xA9,b\n\xE6\x97\xA5\"\n") << QChar(',') << QChar('"') << E::IllegalEscape;
+
+    // Block boundary (byte 64)
+    QTest::newRow("Delimiter at boundary") << atBoundary(0, "a,", ",b\nc,d,e\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Delimiter before boundary") << atBoundary(1, "a,", ",b\nc,d,e\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Opening quote at boundary") << atBoundary(1, "a,", ",\"b,\"\nc,d,e\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Doubled quote across boundary") << atBoundary(1, "a,\"", "\"\"b\"\nc,d\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Closing quote at boundary") << atBoundary(0, "a,\"", "\",b\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("CRLF across boundary") << atBoundary(1, "a,", "\r\nc,d\r\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Multi-byte across boundary") << atBoundary(1, "a,", "\xC3\xA9\nc,d\n") << QChar(',') << QChar('"') << E::NoError;
+    QTest::newRow("Illegal escape at boundary") << atBoundary(0, "a,", "\"\n") << QChar(',') << QChar('"') << E::IllegalEscape;
+    QTest::newRow("Illegal escape across boundary") << atBoundary(1, "a,\"", "\"\xC3\xA9\n") << QChar(',') << QChar('"') << E::IllegalEscape;
+    QTest::newRow("Uneven row at boundary") << atBoundary(0, "a,b\n", "\nc,d\n") << QChar(',') << QChar('"') << E::UnevenColumns;
+    QTest::newRow("Unterminated across boundary") << atBoundary(1, "a,\"", "\n") << QChar(',') << QChar('"') << E::UnterminatedField;
+    QTest::newRow("BOM shifts boundary") << atBoundary(-3, "\xEF\xBB\xBF" "a,", ",\"b\"\"\"\nc,d,e\n") << QChar(',') << QChar('"') << E::NoError;
+}
+
+void tst_qx_dsvtable::byteParserMatchesStreamParser()
+{
+    // Fetch data from test table
+    QFETCH(QByteArray, dsv);
+    QFETCH(QChar, delim);
+    QFETCH(QChar, esc);
+    QFETCH(Qx::DsvParseError::ParseError, error);
+
+    /* Parse both ways. The data here is always UTF-8 with ASCII specials, so fromDsv() takes the byte path,
+     * while the same data with non-ASCII specials takes the stream path.
+     */
+    Qx::DsvParseError byteError;
+    Qx::DsvTable byteTable = Qx::DsvTable::fromDsv(dsv, delim, esc, &byteError);
+
+    Qx::DsvParseError streamError;
+    Qx::DsvTable streamTable = Qx::DsvTable::fromDsv(toStreamParsed(dsv, delim, esc), STREAM_DELIM, STREAM_ESC, &streamError);
+
+    // Compare
+    QCOMPARE(streamError.error(), error);
+    QCOMPARE(byteError.error(), streamError.error());
+    if(error != Qx::DsvParseError::NoError)
+        QCOMPARE(toStreamOffset(dsv, byteError.offset(), delim, esc), streamError.offset());
+    QCOMPARE(byteTable.size(), streamTable.size());
+    QVERIFY(byteTable == streamTable);
+}
+
+void tst_qx_dsvtable::finalRow_data()
+{
+    QTest::addColumn<QByteArray>("dsv");
+    QTest::addColumn<Qx::DsvTable>("expected");
+
+    QTest::newRow("Complete") << QByteArray("a,b\nc,d") << Qx::DsvTable{{u"a"_s, u"b"_s}, {u"c"_s, u"d"_s}};
+    QTest::newRow("Short") << QByteArray("a,b\nc") << Qx::DsvTable{{u"a"_s, u"b"_s}, {u"c"_s, QString()}};
+    QTest::newRow("Short, trailing delimiter") << QByteArray("a,b,c\nd,") << Qx::DsvTable{{u"a"_s, u"b"_s, u"c"_s}, {u"d"_s, QString(), QString()}};
+    QTest::newRow("Quoted field") << QByteArray("a,b\nc,\"d\"") << Qx::DsvTable{{u"a"_s, u"b"_s}, {u"c"_s, u"d"_s}};
+    QTest::newRow("Empty quoted field") << QByteArray("a,b\nc,\"\"") << Qx::DsvTable{{u"a"_s, u"b"_s}, {u"c"_s, QString()}};
+    QTest::newRow("Short, quoted field") << QByteArray("a,b\n\"c,\"") << Qx::DsvTable{{u"a"_s, u"b"_s}, {u"c,"_s, QString()}};
+    QTest::newRow("Only row, quoted field") << QByteArray("a,\"b\"\"\"") << Qx::DsvTable{{u"a"_s, u"b\""_s}};
+}
+
+void tst_qx_dsvtable::finalRow()
+{
+    // Fetch data from test table
+    QFETCH(QByteArray, dsv);
+    QFETCH(Qx::DsvTable, expected);
+
+    // A final row without a trailing line break is kept in full, and padded out if it's short
+    Qx::DsvParseError error;
+    Qx::DsvTable byteTable = Qx::DsvTable::fromDsv(dsv, ',', '"', &error);
+    QCOMPARE(error.error(), Qx::DsvParseError::NoError);
+    QVERIFY(byteTable == expected);
+
+    Qx::DsvTable streamTable = Qx::DsvTable::fromDsv(toStreamParsed(dsv, ',', '"'), STREAM_DELIM, STREAM_ESC, &error);
+    QCOMPARE(error.error(), Qx::DsvParseError::NoError);
+    QVERIFY(streamTable == expected);
+}
+
+void tst_qx_dsvtable::readerResumesAfterStall()
+{
+    TrickleDevice device;
+    Qx::DsvReader reader(&device);
+    reader.setReadTimeout(10);
+    QStringList row;
+
+    // Rows that are complete are handed out
+    device.provide("a,b\nc,");
+    QVERIFY(reader.readRow(row));
+    QCOMPARE(row, (QStringList{u"a"_s, u"b"_s}));
+
+    // The partial row is held while the device stalls
+    QVERIFY(!reader.readRow(row));
+    QVERIFY(!reader.atEnd());
+    QVERIFY(!reader.hasError());
+
+    // And is completed once more data arrives
+    device.provide("d\ne,f");
+    QVERIFY(reader.readRow(row));
+    QCOMPARE(row, (QStringList{u"c"_s, u"d"_s}));
+
+    // The final row is only known to be complete when the device ends
+    QVERIFY(!reader.readRow(row));
+    QVERIFY(!reader.atEnd());
+
+    device.end();
+    QVERIFY(reader.readRow(row));
+    QCOMPARE(row, (QStringList{u"e"_s, u"f"_s}));
+    QVERIFY(!reader.readRow(row));
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+}
+
+void tst_qx_dsvtable::typedStopsAtTypeMismatch()
+{
+    using Type = Qx::TypedDsvTable::ColumnType;
+
+    // The unterminated field after the mismatch is never reached
+    Qx::DsvParseError error;
+    Qx::TypedDsvTable table = Qx::TypedDsvTable::fromDsv("1,a\nx,b\n2,\"c", {Type::Integer}, false, ',', '"', &error);
+    QCOMPARE(error.error(), Qx::DsvParseError::TypeMismatch);
+    QCOMPARE(error.offset(), 6);
+    QCOMPARE(table.columnCount(), 0);
+}
+
+QTEST_APPLESS_MAIN(tst_qx_dsvtable)
+#include "tst_qx_dsvtable.moc"
@@ -0,0 +1,201 @@
+// Standard Library Includes
+#include <map>
+#include <random>
+
+// Qt Includes
+#include <QtTest>
+
+// Qx Includes
+#include <qx/core/qx-flatbimap.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+using namespace Qt::Literals::StringLiterals;
+
+class tst_qx_flatbimap : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_flatbimap();
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void insertReplacesStaleRelations();
+    void eraseMovesLast();
+    void reserveAndRehash();
+    void lookupAfterRemovals();
+};
+
+// Setup
+tst_qx_flatbimap::tst_qx_flatbimap() {}
+
+// Cases
+void tst_qx_flatbimap::insertReplacesStaleRelations()
+{
+    Qx::FlatBimap<int, QString> bimap{{1, u"a"_s}, {2, u"b"_s}, {3, u"c"_s}};
+
+    // Existing relation
+    auto itr = bimap.insert(2, u"b"_s);
+    QCOMPARE(itr.left(), 2);
+    QCOMPARE(itr.right(), u"b"_s);
+    QCOMPARE(bimap.size(), 3);
+
+    // Stale left
+    bimap.insert(1, u"d"_s);
+    QCOMPARE(bimap.size(), 3);
+    QCOMPARE(bimap.fromLeft(1), u"d"_s);
+    QVERIFY(!bimap.containsRight(u"a"_s));
+
+    // Stale right
+    bimap.insert(4, u"b"_s);
+    QCOMPARE(bimap.size(), 3);
+    QCOMPARE(bimap.fromRight(u"b"_s), 4);
+    QVERIFY(!bimap.containsLeft(2));
+
+    // Stale on both sides, from different relations
+    bimap.insert(3, u"d"_s);
+    QCOMPARE(bimap.size(), 2);
+    QCOMPARE(bimap.fromLeft(3), u"d"_s);
+    QCOMPARE(bimap.fromRight(u"d"_s), 3);
+    QVERIFY(!bimap.containsLeft(1));
+    QVERIFY(!bimap.containsRight(u"c"_s));
+    QCOMPARE(bimap.fromLeft(4), u"b"_s);
+
+    QCOMPARE(bimap, (Qx::FlatBimap<int, QString>{{4, u"b"_s}, {3, u"d"_s}}));
+}
+
+void tst_qx_flatbimap::eraseMovesLast()
+{
+    Qx::FlatBimap<int, QString> bimap;
+    for(int i = 0; i < 5; ++i)
+        bimap.insert(i, QString::number(i));
+
+    // The last relation takes the place of the erased one
+    auto next = bimap.erase(bimap.findLeft(1));
+    QCOMPARE(next.left(), 4);
+    QCOMPARE(bimap.lefts(), QList<int>({0, 4, 2, 3}));
+
+    // Erasing the last relation leaves nothing to move
+    next = bimap.erase(bimap.findLeft(3));
+    QVERIFY(next == bimap.cend());
+    QCOMPARE(bimap.lefts(), QList<int>({0, 4, 2}));
+
+    for(int i : {0, 2, 4})
+    {
+        QCOMPARE(bimap.fromLeft(i), QString::number(i));
+        QCOMPARE(bimap.fromRight(QString::number(i)), i);
+    }
+
+    QCOMPARE(bimap.takeRight(0), u"0"_s);
+    QCOMPARE(bimap.lefts(), QList<int>({2, 4}));
+    QCOMPARE(bimap.fromRight(u"4"_s), 4);
+}
+
+void tst_qx_flatbimap::reserveAndRehash()
+{
+    Qx::FlatBimap<int, QString> bimap;
+    bimap.reserve(1000);
+    QVERIFY(bimap.capacity() >= 1000);
+
+    for(int i = 0; i < 1000; ++i)
+        bimap.insert(i, QString::number(i));
+    QVERIFY(bimap.load_factor() <= 0.5f);
+
+    // Shrinking the indexes keeps every relation reachable
+    bimap.removeIf([](std::pair<const int&, const QString&> r){ return r.first >= 10; });
+    QCOMPARE(bimap.size(), 10);
+    float sparse = bimap.load_factor();
+    bimap.rehash(0);
+    QVERIFY(bimap.load_factor() > sparse);
+    QVERIFY(bimap.load_factor() <= 0.5f);
+
+    bimap.squeeze();
+    for(int i = 0; i < 10; ++i)
+    {
+        QCOMPARE(bimap.fromLeft(i), QString::number(i));
+        QCOMPARE(bimap.fromRight(QString::number(i)), i);
+    }
+
+    // Growing again afterwards
+    for(int i = 10; i < 100; ++i)
+        bimap.insert(i, QString::number(i));
+    for(int i = 0; i < 100; ++i)
+        QCOMPARE(bimap.fromRight(QString::number(i)), i);
+}
+
+void tst_qx_flatbimap::lookupAfterRemovals()
+{
+    // Heavy churn within a small key space exercises backward-shift deletion across long clusters
+    Qx::FlatBimap<int, qint64> bimap;
+    std::map<int, qint64> leftToRight;
+    std::map<qint64, int> rightToLeft;
+    std::minstd_rand gen(7);
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        int l = gen() % 300;
+        qint64 r = 1000 + gen() % 300;
+
+        if(gen() % 3)
+        {
+            if(auto it = leftToRight.find(l); it != leftToRight.end())
+                rightToLeft.erase(it->second);
+            if(auto it = rightToLeft.find(r); it != rightToLeft.end())
+                leftToRight.erase(it->second);
+            leftToRight[l] = r;
+            rightToLeft[r] = l;
+            bimap.insert(l, r);
+        }
+        else if(gen() % 2)
+        {
+            bool had = leftToRight.contains(l);
+            if(had)
+            {
+                rightToLeft.erase(leftToRight[l]);
+                leftToRight.erase(l);
+            }
+            QCOMPARE(bimap.removeLeft(l), had);
+        }
+        else
+        {
+            bool had = rightToLeft.contains(r);
+            if(had)
+            {
+                leftToRight.erase(rightToLeft[r]);
+                rightToLeft.erase(r);
+            }
+            QCOMPARE(bimap.removeRight(r), had);
+        }
+
+        if(i % 1000 == 0)
+            bimap.squeeze();
+    }
+
+    QCOMPARE(bimap.size(), qsizetype(leftToRight.size()));
+    for(int l = 0; l < 300; ++l)
+    {
+        auto it = leftToRight.find(l);
+        QCOMPARE(bimap.containsLeft(l), it != leftToRight.end());
+        if(it != leftToRight.end())
+            QCOMPARE(bimap.fromLeft(l), it->second);
+    }
+    for(qint64 r = 1000; r < 1300; ++r)
+    {
+        auto it = rightToLeft.find(r);
+        QCOMPARE(bimap.containsRight(r), it != rightToLeft.end());
+        if(it != rightToLeft.end())
+            QCOMPARE(bimap.fromRight(r), it->second);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_qx_flatbimap)
+#include "tst_qx_flatbimap.moc"
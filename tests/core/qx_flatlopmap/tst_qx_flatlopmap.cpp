@@ -0,0 +1,186 @@
+// Standard Library Includes
+#include <random>
+
+// Qt Includes
+#include <QtTest>
+
+// Qx Includes
+#include <qx/core/qx-flatlopmap.h>
+#include <qx/core/qx-lopmap.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+
+// Only hashable via qHash()
+struct Tag
+{
+    int id;
+    bool operator==(const Tag& other) const = default;
+};
+
+size_t qHash(const Tag& tag, size_t seed = 0) { return ::qHash(tag.id, seed); }
+
+template<typename Itr>
+qsizetype offset(Itr first, Itr pos)
+{
+    qsizetype n = 0;
+    for(; first != pos; ++first)
+        ++n;
+    return n;
+}
+
+}
+
+class tst_qx_flatlopmap : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_flatlopmap();
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void matchesLopmap();
+    void equalValueOrder();
+    void qHashKey();
+};
+
+// Setup
+tst_qx_flatlopmap::tst_qx_flatlopmap() {}
+
+// Cases
+void tst_qx_flatlopmap::matchesLopmap()
+{
+    Qx::Lopmap<int, int> reference;
+    Qx::FlatLopmap<int, int> flat;
+    std::minstd_rand gen(42);
+
+    for(int i = 0; i < 5000; ++i)
+    {
+        int key = gen() % 200;
+        int value = gen() % 25;
+
+        switch(gen() % 8)
+        {
+            case 0:
+            case 1:
+            case 2:
+                QCOMPARE(*flat.insert(key, value), *reference.insert(key, value));
+                break;
+
+            case 3:
+                // Only hint new keys, Lopmap erases the existing element before using the hint
+                if(!reference.contains(key))
+                {
+                    bool lower = gen() % 2;
+                    auto rHint = lower ? reference.lowerBound(value) : reference.upperBound(value);
+                    auto fHint = lower ? flat.lowerBound(value) : flat.upperBound(value);
+                    reference.insert(rHint, key, value);
+                    flat.insert(fHint, key, value);
+                }
+                break;
+
+            case 4:
+                QCOMPARE(flat.remove(key), qsizetype(reference.remove(key)));
+                break;
+
+            case 5:
+                QCOMPARE(flat.take(key), reference.take(key));
+                break;
+
+            case 6:
+            {
+                // Lopmap can't erase through its end
+                auto [rFirst, rLast] = reference.equal_range(value);
+                auto [fFirst, fLast] = flat.equal_range(value);
+                QCOMPARE(offset(fFirst, fLast), offset(rFirst, rLast));
+                if(rFirst != rLast && rLast != reference.cend())
+                {
+                    QCOMPARE(flat.erase(fFirst, fLast).key(), reference.erase(rFirst, rLast).key());
+                }
+                break;
+            }
+
+            case 7:
+            {
+                const QList<int> matching = reference.keys(value);
+                for(int k : matching)
+                    reference.remove(k);
+
+                QCOMPARE(flat.removeIf([value](std::pair<const int&, const int&> p){ return p.second == value; }), matching.size());
+                break;
+            }
+        }
+
+        // Same contents in the same order
+        QCOMPARE(flat.size(), reference.size());
+        QCOMPARE(flat.keys(), reference.keys());
+        QCOMPARE(flat.values(), reference.values());
+        QCOMPARE(flat.contains(key), reference.contains(key));
+        QCOMPARE(flat.value(key, -1), reference.value(key, -1));
+        QCOMPARE(flat.keys(value), reference.keys(value));
+        QCOMPARE(offset(flat.cbegin(), flat.lowerBound(value)), offset(reference.cbegin(), reference.lowerBound(value)));
+        QCOMPARE(offset(flat.cbegin(), flat.upperBound(value)), offset(reference.cbegin(), reference.upperBound(value)));
+        if(!reference.isEmpty())
+        {
+            QCOMPARE(flat.first(), reference.first());
+            QCOMPARE(flat.firstKey(), reference.firstKey());
+        }
+
+        if(i % 500 == 0)
+            flat.squeeze();
+    }
+}
+
+void tst_qx_flatlopmap::equalValueOrder()
+{
+    // Equal values keep insertion order, and changing a value moves it after its new equals
+    Qx::FlatLopmap<QString, int> map{{u"a"_s, 5}, {u"b"_s, 5}, {u"c"_s, 5}, {u"d"_s, 1}};
+    QCOMPARE(map.keys(), QStringList({u"d"_s, u"a"_s, u"b"_s, u"c"_s}));
+
+    map.insert(u"a"_s, 6);
+    map.insert(u"a"_s, 5);
+    QCOMPARE(map.keys(), QStringList({u"d"_s, u"b"_s, u"c"_s, u"a"_s}));
+
+    map.insert(u"c"_s, 1);
+    QCOMPARE(map.keys(), QStringList({u"d"_s, u"c"_s, u"b"_s, u"a"_s}));
+
+    // Setting the same value doesn't move anything
+    map.insert(u"d"_s, 1);
+    QCOMPARE(map.keys(), QStringList({u"d"_s, u"c"_s, u"b"_s, u"a"_s}));
+    QCOMPARE(map.lastKey(), u"a"_s);
+    QCOMPARE(map.last(), 5);
+}
+
+void tst_qx_flatlopmap::qHashKey()
+{
+    Qx::FlatLopmap<Tag, int> map;
+    for(int i = 0; i < 100; ++i)
+        map.insert(Tag{i}, 100 - i);
+
+    QCOMPARE(map.size(), 100);
+    QCOMPARE(map.firstKey(), Tag{99});
+    QCOMPARE(map.value(Tag{40}), 60);
+
+    for(int i = 0; i < 100; i += 2)
+        QCOMPARE(map.remove(Tag{i}), 1);
+
+    QCOMPARE(map.size(), 50);
+    QVERIFY(!map.contains(Tag{40}));
+    QCOMPARE(map.value(Tag{41}), 59);
+}
+
+QTEST_APPLESS_MAIN(tst_qx_flatlopmap)
+#include "tst_qx_flatlopmap.moc"
@@ -0,0 +1,208 @@
+// Qt Includes
+#include <QtTest>
+
+// Qx Includes
+#include <qx/core/qx-flatmultiset.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+namespace
+{
+
+// Ordered by key alone, so that the order of equivalent items is observable through their tag
+struct Item
+{
+    int key;
+    char tag;
+    bool operator==(const Item& other) const = default;
+};
+
+struct ByKey
+{
+    bool operator()(const Item& a, const Item& b) const { return a.key < b.key; }
+};
+
+using ItemSet = Qx::FlatMultiSet<Item, ByKey>;
+
+}
+
+class tst_qx_flatmultiset : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_flatmultiset();
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void emplace();
+    void find();
+    void equalRange();
+    void remove();
+    void equality();
+    void bulkConstruction();
+    void merge();
+    void insertRange();
+    void containsSet();
+};
+
+// Setup
+tst_qx_flatmultiset::tst_qx_flatmultiset() {}
+
+// Cases
+void tst_qx_flatmultiset::emplace()
+{
+    Qx::FlatMultiSet<int> set{1, 3, 5};
+
+    auto itr = set.emplace(4);
+    QCOMPARE(*itr, 4);
+    QCOMPARE(itr - set.cbegin(), 2);
+
+    // Hints, correct and not
+    itr = set.insert(set.cend(), 6);
+    QCOMPARE(itr - set.cbegin(), 4);
+    itr = set.insert(set.cbegin(), 2);
+    QCOMPARE(itr - set.cbegin(), 1);
+    itr = set.insert(set.cend(), 0);
+    QCOMPARE(itr - set.cbegin(), 0);
+
+    QCOMPARE(set.values(), QList<int>({0, 1, 2, 3, 4, 5, 6}));
+}
+
+void tst_qx_flatmultiset::find()
+{
+    Qx::FlatMultiSet<int> set{1, 2, 2, 4, 7, 9, 9, 9, 12};
+
+    for(int v : {1, 2, 4, 7, 9, 12})
+    {
+        auto itr = set.constFind(v);
+        QVERIFY(itr != set.cend());
+        QCOMPARE(*itr, v);
+        QVERIFY(set.contains(v));
+    }
+
+    for(int v : {0, 3, 8, 13})
+    {
+        QVERIFY(set.constFind(v) == set.cend());
+        QVERIFY(!set.contains(v));
+    }
+
+    QVERIFY(Qx::FlatMultiSet<int>().constFind(1) == Qx::FlatMultiSet<int>().cend());
+
+    // Lookups go through the set's comparator
+    ItemSet items{{1, 'a'}, {2, 'b'}};
+    QVERIFY(items.contains({2, 'z'}));
+    QCOMPARE(items.constFind({1, 'z'})->tag, 'a');
+    QVERIFY(!items.contains({3, 'b'}));
+}
+
+void tst_qx_flatmultiset::equalRange()
+{
+    Qx::FlatMultiSet<int> set{3, 1, 2, 2, 2};
+
+    auto [first, last] = set.equal_range(2);
+    QCOMPARE(first - set.cbegin(), 1);
+    QCOMPARE(last - set.cbegin(), 4);
+
+    std::tie(first, last) = set.equal_range(5);
+    QVERIFY(first == set.cend() && last == set.cend());
+}
+
+void tst_qx_flatmultiset::remove()
+{
+    Qx::FlatMultiSet<int> set{1, 2, 2, 2, 3};
+
+    QCOMPARE(set.remove(2), 3);
+    QCOMPARE(set.values(), QList<int>({1, 3}));
+
+    // Missing values, including those past the end
+    QCOMPARE(set.remove(2), 0);
+    QCOMPARE(set.remove(10), 0);
+
+    QCOMPARE(set.remove(3), 1);
+    QCOMPARE(set.remove(1), 1);
+    QVERIFY(set.isEmpty());
+    QCOMPARE(set.remove(1), 0);
+}
+
+void tst_qx_flatmultiset::equality()
+{
+    Qx::FlatMultiSet<int> a{3, 1, 2};
+    Qx::FlatMultiSet<int> b{1, 2, 3};
+    QVERIFY(a == b);
+
+    b.insert(2);
+    QVERIFY(a != b);
+
+    // Operator is available with a custom comparator too
+    QVERIFY(ItemSet({{1, 'a'}}) == ItemSet({{1, 'a'}}));
+    QVERIFY(ItemSet({{1, 'a'}}) != ItemSet({{1, 'b'}}));
+}
+
+void tst_qx_flatmultiset::bulkConstruction()
+{
+    const QList<Item> items{{2, 'a'}, {1, 'b'}, {2, 'c'}, {0, 'd'}, {1, 'e'}, {2, 'f'}};
+
+    // Same result as inserting one at a time, equivalent items keeping their relative order
+    ItemSet inserted;
+    for(const Item& i : items)
+        inserted.insert(i);
+
+    const QList<Item> expected{{0, 'd'}, {1, 'b'}, {1, 'e'}, {2, 'a'}, {2, 'c'}, {2, 'f'}};
+    QCOMPARE(inserted.values(), expected);
+    QCOMPARE(ItemSet(items.cbegin(), items.cend()).values(), expected);
+    QCOMPARE(ItemSet({{2, 'a'}, {1, 'b'}, {2, 'c'}, {0, 'd'}, {1, 'e'}, {2, 'f'}}).values(), expected);
+}
+
+void tst_qx_flatmultiset::merge()
+{
+    // Equivalent items from the receiving set come first
+    ItemSet a{{1, 'a'}, {2, 'b'}, {2, 'c'}, {4, 'd'}};
+    ItemSet b{{0, 'e'}, {2, 'f'}, {3, 'g'}, {4, 'h'}};
+    a.merge(b);
+    QCOMPARE(a.values(), QList<Item>({{0, 'e'}, {1, 'a'}, {2, 'b'}, {2, 'c'}, {2, 'f'}, {3, 'g'}, {4, 'd'}, {4, 'h'}}));
+
+    // Already in order
+    ItemSet c{{0, 'a'}, {1, 'b'}};
+    c.merge(ItemSet{{1, 'c'}, {5, 'd'}});
+    QCOMPARE(c.values(), QList<Item>({{0, 'a'}, {1, 'b'}, {1, 'c'}, {5, 'd'}}));
+
+    // Empty on either side
+    ItemSet empty;
+    c.merge(empty);
+    QCOMPARE(c.size(), 4);
+    empty.merge(c);
+    QVERIFY(empty == c);
+}
+
+void tst_qx_flatmultiset::insertRange()
+{
+    ItemSet set{{1, 'a'}, {3, 'b'}};
+    const QList<Item> more{{3, 'c'}, {0, 'd'}, {1, 'e'}, {3, 'f'}, {2, 'g'}};
+    set.insertRange(more.cbegin(), more.cend());
+
+    QCOMPARE(set.values(), QList<Item>({{0, 'd'}, {1, 'a'}, {1, 'e'}, {2, 'g'}, {3, 'b'}, {3, 'c'}, {3, 'f'}}));
+}
+
+void tst_qx_flatmultiset::containsSet()
+{
+    Qx::FlatMultiSet<int> set{1, 2, 2, 5, 8};
+
+    QVERIFY(set.contains(Qx::FlatMultiSet<int>{2, 8}));
+    QVERIFY(set.contains(Qx::FlatMultiSet<int>{1, 2, 5, 8}));
+    QVERIFY(set.contains(Qx::FlatMultiSet<int>()));
+    QVERIFY(!set.contains(Qx::FlatMultiSet<int>{2, 3}));
+    QVERIFY(!set.contains(Qx::FlatMultiSet<int>{9}));
+    QVERIFY(!Qx::FlatMultiSet<int>().contains(Qx::FlatMultiSet<int>{1}));
+}
+
+QTEST_APPLESS_MAIN(tst_qx_flatmultiset)
+#include "tst_qx_flatmultiset.moc"
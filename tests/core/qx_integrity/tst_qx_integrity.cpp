@@ -25,16 +25,145 @@ private slots:
     // Test cases
     // void generateCheckum();
     void crc32();
+    void crc32_data();
+    void crc32Accumulator();
+    void crc32Combine();
+    void hasher();
 };
 
 // Setup
 tst_qx_integrity::tst_qx_integrity() {}
 
+// Helpers
+namespace
+{
+
+QByteArray patternedData(qsizetype size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    for(qsizetype i = 0; i < size; ++i)
+        data[i] = static_cast<char>((i * 31 + (i >> 8)) & 0xFF);
+    return data;
+}
+
+quint32 bitwiseCrc32(QByteArrayView data)
+{
+    // Straightforward reference implementation
+    quint32 crc = 0xFFFFFFFF;
+    for(quint8 byte : data)
+    {
+        crc ^= byte;
+        for(int bit = 0; bit < 8; bit++)
+            crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+    }
+    return ~crc;
+}
+
+}
+
 // Cases
+void tst_qx_integrity::crc32_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<quint32>("expected");
+
+    QTest::newRow("Empty") << QByteArray() << quint32(0);
+    QTest::newRow("Check value") << QByteArrayLiteral("123456789") << quint32(0xCBF43926);
+    QTest::newRow("Short") << QByteArrayLiteral("ThisIsForCRC32Testing") << quint32(0x926CE4A1);
+
+    // Sizes around the thresholds of the different processing strategies
+    for(qsizetype size : {15, 16, 17, 63, 64, 65, 127, 128, 129, 4095, 65537})
+    {
+        QByteArray data = patternedData(size);
+        QTest::addRow("Patterned %lld", static_cast<long long>(size)) << data << bitwiseCrc32(data);
+    }
+}
+
 void tst_qx_integrity::crc32()
 {
-    quint32 res = Qx::Integrity::crc32(QByteArrayLiteral("ThisIsForCRC32Testing"));
-    QCOMPARE(res, 0x926CE4A1);
+    QFETCH(QByteArray, data);
+    QFETCH(quint32, expected);
+
+    QCOMPARE(Qx::Integrity::crc32(data), expected);
+}
+
+void tst_qx_integrity::crc32Accumulator()
+{
+    QByteArray data = patternedData(10000);
+    quint32 expected = bitwiseCrc32(data);
+
+    // Uneven pieces
+    Qx::Crc32 crc;
+    qsizetype pos = 0;
+    for(qsizetype piece = 1; pos < data.size(); piece = piece * 3 + 1)
+    {
+        qsizetype size = std::min(piece, data.size() - pos);
+        crc.update(QByteArrayView(data).sliced(pos, size));
+        pos += size;
+    }
+    QCOMPARE(crc.length(), qint64(data.size()));
+    QCOMPARE(crc.finalize(), expected);
+
+    // Reset
+    crc.reset();
+    QCOMPARE(crc.length(), qint64(0));
+    QCOMPARE(crc.finalize(), quint32(0));
+    crc.update(data);
+    QCOMPARE(crc.finalize(), expected);
+}
+
+void tst_qx_integrity::crc32Combine()
+{
+    QByteArray data = patternedData(5000);
+    quint32 expected = bitwiseCrc32(data);
+
+    for(qsizetype split : {0, 1, 100, 2500, 4999, 5000})
+    {
+        QByteArrayView first = QByteArrayView(data).first(split);
+        QByteArrayView second = QByteArrayView(data).sliced(split);
+
+        QCOMPARE(Qx::Crc32::combine(Qx::Integrity::crc32(first), Qx::Integrity::crc32(second), second.size()), expected);
+
+        Qx::Crc32 a, b;
+        a.update(first);
+        b.update(second);
+        a.combine(b);
+        QCOMPARE(a.finalize(), expected);
+        QCOMPARE(a.length(), qint64(data.size()));
+    }
+}
+
+void tst_qx_integrity::hasher()
+{
+    QByteArray data = patternedData(200000);
+
+    // Cryptographic
+    Qx::Hasher sha(QCryptographicHash::Sha256);
+    QVERIFY(!sha.isCrc32());
+    sha.addData(QByteArrayView(data).first(1000));
+    sha.addData(QByteArrayView(data).sliced(1000));
+    QCOMPARE(sha.result(), QCryptographicHash::hash(data, QCryptographicHash::Sha256));
+
+    // CRC-32, big-endian digest
+    Qx::Hasher crc(Qx::Hasher::CRC32);
+    QVERIFY(crc.isCrc32());
+    crc.addData(QByteArrayLiteral("123456789"));
+    QCOMPARE(crc.result(), QByteArray::fromHex("CBF43926"));
+
+    // Device
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    crc.reset();
+    QVERIFY(crc.addData(&buffer));
+    QCOMPARE(crc.result().toHex(), QByteArray::number(bitwiseCrc32(data), 16).rightJustified(8, '0'));
+
+    // Seeded CRC-32, continuing on from earlier data
+    Qx::Crc32 seed;
+    seed.update(QByteArrayView(data).first(1000));
+    Qx::Hasher seeded(seed);
+    QVERIFY(seeded.isCrc32());
+    seeded.addData(QByteArrayView(data).sliced(1000));
+    QCOMPARE(seeded.result(), crc.result());
 }
 
 QTEST_APPLESS_MAIN(tst_qx_integrity)
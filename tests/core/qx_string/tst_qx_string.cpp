@@ -0,0 +1,93 @@
+// Qt Includes
+#include <QtTest>
+
+// Qx Includes
+#include <qx/core/qx-string.h>
+#include <qx/core/qx-stringmapper.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+using namespace Qt::Literals::StringLiterals;
+
+using StringMap = QMap<QString, QString>;
+
+class tst_qx_string : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_string();
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void mapArg_data();
+    void mapArg();
+};
+
+// Setup
+tst_qx_string::tst_qx_string() {}
+
+// Cases
+void tst_qx_string::mapArg_data()
+{
+    QTest::addColumn<QString>("s");
+    QTest::addColumn<StringMap>("args");
+    QTest::addColumn<Qt::CaseSensitivity>("cs");
+    QTest::addColumn<QString>("expected");
+
+    using M = StringMap;
+    const auto CS = Qt::CaseSensitive;
+    const auto CI = Qt::CaseInsensitive;
+
+    // Basics
+    QTest::newRow("No match") << u"abc"_s << M{{u"x"_s, u"1"_s}} << CS << u"abc"_s;
+    QTest::newRow("Adjacent") << u"{a}{b}"_s << M{{u"{a}"_s, u"1"_s}, {u"{b}"_s, u"2"_s}} << CS << u"12"_s;
+    QTest::newRow("Replacements aren't rescanned") << u"ab"_s << M{{u"a"_s, u"b"_s}, {u"b"_s, u"c"_s}} << CS << u"bc"_s;
+
+    // Overlapping keys, where the leftmost match wins and consumes its text
+    QTest::newRow("Overlapping") << u"abcd"_s << M{{u"ab"_s, u"X"_s}, {u"bc"_s, u"Y"_s}} << CS << u"Xcd"_s;
+    QTest::newRow("Self-overlapping") << u"aaa"_s << M{{u"aa"_s, u"X"_s}} << CS << u"Xa"_s;
+    QTest::newRow("Leftmost over first to end") << u"abcd"_s << M{{u"abcd"_s, u"1"_s}, {u"bc"_s, u"2"_s}} << CS << u"1"_s;
+    QTest::newRow("Failed longer key") << u"abce"_s << M{{u"abcd"_s, u"1"_s}, {u"bc"_s, u"2"_s}} << CS << u"a2e"_s;
+    QTest::newRow("Suffix key") << u"xabc"_s << M{{u"abc"_s, u"1"_s}, {u"bc"_s, u"2"_s}} << CS << u"x1"_s;
+
+    // Prefix keys, where the shortest match wins
+    QTest::newRow("Prefix") << u"abcabd"_s << M{{u"ab"_s, u"1"_s}, {u"abc"_s, u"2"_s}} << CS << u"1c1d"_s;
+    QTest::newRow("Single character prefix") << u"abc ab"_s << M{{u"a"_s, u"A"_s}, {u"abc"_s, u"B"_s}} << CS << u"Abc Ab"_s;
+
+    // Case sensitivity
+    QTest::newRow("Case-sensitive keys") << u"aA"_s << M{{u"a"_s, u"1"_s}, {u"A"_s, u"2"_s}} << CS << u"12"_s;
+    QTest::newRow("Case-sensitive miss") << u"hello"_s << M{{u"HeLLo"_s, u"X"_s}} << CS << u"hello"_s;
+    QTest::newRow("Case-insensitive") << u"Hello HELLO hello"_s << M{{u"hello"_s, u"X"_s}} << CI << u"X X X"_s;
+    QTest::newRow("Case-insensitive mixed key") << u"hello"_s << M{{u"HeLLo"_s, u"X"_s}} << CI << u"X"_s;
+    QTest::newRow("Case-insensitive prefix") << u"ABCD"_s << M{{u"abc"_s, u"1"_s}, {u"Ab"_s, u"2"_s}} << CI << u"2CD"_s;
+    QTest::newRow("Case-insensitive overlap") << u"aBcD"_s << M{{u"AB"_s, u"1"_s}, {u"bcd"_s, u"2"_s}} << CI << u"1cD"_s;
+}
+
+void tst_qx_string::mapArg()
+{
+    // Fetch data from test table
+    QFETCH(QString, s);
+    QFETCH(StringMap, args);
+    QFETCH(Qt::CaseSensitivity, cs);
+    QFETCH(QString, expected);
+
+    // Test
+    QCOMPARE(Qx::String::mapArg(s, args, cs), expected);
+
+    // A reused mapper must behave the same
+    Qx::StringMapper mapper(args, cs);
+    QCOMPARE(mapper.map(s), expected);
+    QCOMPARE(mapper.map(s), expected);
+}
+
+QTEST_APPLESS_MAIN(tst_qx_string)
+#include "tst_qx_string.moc"
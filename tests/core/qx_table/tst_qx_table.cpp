@@ -0,0 +1,261 @@
+// Qt Includes
+#include <QtTest>
+
+// Qx Includes
+#include <qx/core/qx-table.h>
+
+// Test Includes
+//#include <qx_test_common.h>
+
+class tst_qx_table : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_qx_table();
+
+private:
+    static Qx::Table<int> sample(bool columnMajor);
+
+private slots:
+    // Init
+    // void initTestCase();
+    // void initTestCase_data();
+    // void cleanupTestCase();
+    // void init()
+    // void cleanup();
+
+    // Test cases
+    void rowsAreCopies_data();
+    void rowsAreCopies();
+    void rowIteratorYieldsViews_data();
+    void rowIteratorYieldsViews();
+    void emptyWithoutColumns();
+    void lastColumn_data();
+    void lastColumn();
+    void removeLastRow_data();
+    void removeLastRow();
+    void appendRowAndColumn_data();
+    void appendRowAndColumn();
+    void section_data();
+    void section();
+};
+
+// Setup
+tst_qx_table::tst_qx_table() {}
+
+// Helpers
+Qx::Table<int> tst_qx_table::sample(bool columnMajor)
+{
+    // 3 rows, 2 columns, so that mixing up the dimensions is caught
+    Qx::Table<int> table{
+        {1, 2},
+        {3, 4},
+        {5, 6}
+    };
+
+    if(columnMajor)
+        table.setLayout(Qx::Table<int>::ColumnMajor);
+
+    return table;
+}
+
+// Cases
+void tst_qx_table::rowsAreCopies_data()
+{
+    QTest::addColumn<bool>("columnMajor");
+    QTest::newRow("Row-major") << false;
+    QTest::newRow("Column-major") << true;
+}
+
+void tst_qx_table::rowsAreCopies()
+{
+    QFETCH(bool, columnMajor);
+    Qx::Table<int> table = sample(columnMajor);
+
+    QList<int> first = table.firstRow();
+    QList<int> middle = table.rowAt(1);
+    QList<int> last = table.lastRow();
+    QCOMPARE(first, (QList<int>{1, 2}));
+    QCOMPARE(middle, (QList<int>{3, 4}));
+    QCOMPARE(last, (QList<int>{5, 6}));
+
+    // Changing a copy leaves the table alone...
+    first[0] = 10;
+    middle[1] = 40;
+    last[0] = 50;
+    QCOMPARE(table.at(0, 0), 1);
+    QCOMPARE(table.at(1, 1), 4);
+    QCOMPARE(table.at(2, 0), 5);
+
+    // ...and vice versa
+    table.at(0, 1) = 20;
+    QCOMPARE(first, (QList<int>{10, 2}));
+    QCOMPARE(table.firstRow(), (QList<int>{1, 20}));
+}
+
+void tst_qx_table::rowIteratorYieldsViews_data()
+{
+    QTest::addColumn<bool>("columnMajor");
+    QTest::newRow("Row-major") << false;
+    QTest::newRow("Column-major") << true;
+}
+
+void tst_qx_table::rowIteratorYieldsViews()
+{
+    QFETCH(bool, columnMajor);
+    Qx::Table<int> table = sample(columnMajor);
+    const Qx::Table<int>& cTable = table;
+
+    QCOMPARE(table.rowEnd() - table.rowBegin(), 3);
+
+    qsizetype r = 0;
+    for(auto itr = table.rowBegin(); itr != table.rowEnd(); itr++, r++)
+    {
+        Qx::Table<int>::const_view row = *itr;
+        QCOMPARE(row.size(), 2);
+        QCOMPARE(row.isContiguous(), !columnMajor);
+
+        // Views point into the table rather than holding a copy
+        QCOMPARE(&row.at(0), &cTable.at(r, 0));
+        QCOMPARE(&row.at(1), &cTable.at(r, 1));
+        QCOMPARE(row.toList(), table.rowAt(r));
+    }
+    QCOMPARE(r, 3);
+
+    // Which means changes to the table show through
+    Qx::Table<int>::const_view middle = table.rowBegin()[1];
+    table.at(1, 0) = 30;
+    QCOMPARE(middle.first(), 30);
+    QCOMPARE(middle.last(), 4);
+}
+
+void tst_qx_table::emptyWithoutColumns()
+{
+    Qx::Table<int> table(QSize(0, 3));
+    QVERIFY(table.isEmpty());
+    QCOMPARE(table.rowCount(), 3);
+    QCOMPARE(table.columnCount(), 0);
+
+    // Zero-width rows are still distinct rows
+    QCOMPARE(table.rowEnd() - table.rowBegin(), 3);
+    QVERIFY(table.rowBegin() != table.rowEnd());
+    QVERIFY((*table.rowBegin()).isEmpty());
+
+    // Adding a column makes it non-empty
+    table.appendColumn({1, 2, 3});
+    QVERIFY(!table.isEmpty());
+    QCOMPARE(table.size(), QSize(1, 3));
+    QCOMPARE(table.firstColumn(), (QList<int>{1, 2, 3}));
+}
+
+void tst_qx_table::lastColumn_data()
+{
+    QTest::addColumn<bool>("columnMajor");
+    QTest::newRow("Row-major") << false;
+    QTest::newRow("Column-major") << true;
+}
+
+void tst_qx_table::lastColumn()
+{
+    QFETCH(bool, columnMajor);
+    Qx::Table<int> table = sample(columnMajor);
+
+    QCOMPARE(table.lastColumn(), (QList<int>{2, 4, 6}));
+    QCOMPARE(table.firstColumn(), (QList<int>{1, 3, 5}));
+}
+
+void tst_qx_table::removeLastRow_data()
+{
+    QTest::addColumn<bool>("columnMajor");
+    QTest::newRow("Row-major") << false;
+    QTest::newRow("Column-major") << true;
+}
+
+void tst_qx_table::removeLastRow()
+{
+    QFETCH(bool, columnMajor);
+    Qx::Table<int> table = sample(columnMajor);
+
+    table.removeLastRow();
+    QCOMPARE(table.size(), QSize(2, 2));
+    QCOMPARE(table.lastRow(), (QList<int>{3, 4}));
+    QCOMPARE(table.lastColumn(), (QList<int>{2, 4}));
+
+    table.removeLastColumn();
+    QCOMPARE(table.size(), QSize(1, 2));
+    QCOMPARE(table.firstColumn(), (QList<int>{1, 3}));
+}
+
+void tst_qx_table::appendRowAndColumn_data()
+{
+    QTest::addColumn<bool>("columnMajor");
+    QTest::newRow("Row-major") << false;
+    QTest::newRow("Column-major") << true;
+}
+
+void tst_qx_table::appendRowAndColumn()
+{
+    QFETCH(bool, columnMajor);
+    Qx::Table<int> table = sample(columnMajor);
+
+    // Appending a row grows the height
+    table.appendRow({7, 8});
+    QCOMPARE(table.size(), QSize(2, 4));
+    QCOMPARE(table.lastRow(), (QList<int>{7, 8}));
+
+    // Appending a column grows the width
+    table.appendColumn({9, 10, 11, 12});
+    QCOMPARE(table.size(), QSize(3, 4));
+    QCOMPARE(table.lastColumn(), (QList<int>{9, 10, 11, 12}));
+    QCOMPARE(table.firstRow(), (QList<int>{1, 2, 9}));
+
+    // A longer row widens the table, padding the other rows
+    table.appendRow({13, 14, 15, 16});
+    QCOMPARE(table.size(), QSize(4, 5));
+    QCOMPARE(table.firstRow(), (QList<int>{1, 2, 9, 0}));
+    QCOMPARE(table.lastRow(), (QList<int>{13, 14, 15, 16}));
+
+    // A shorter column is padded
+    table.appendColumn({17});
+    QCOMPARE(table.size(), QSize(5, 5));
+    QCOMPARE(table.lastColumn(), (QList<int>{17, 0, 0, 0, 0}));
+}
+
+void tst_qx_table::section_data()
+{
+    QTest::addColumn<bool>("columnMajor");
+    QTest::newRow("Row-major") << false;
+    QTest::newRow("Column-major") << true;
+}
+
+void tst_qx_table::section()
+{
+    QFETCH(bool, columnMajor);
+    Qx::Table<int> table{
+        {1, 2, 3, 4},
+        {5, 6, 7, 8},
+        {9, 10, 11, 12}
+    };
+    if(columnMajor)
+        table.setLayout(Qx::Table<int>::ColumnMajor);
+
+    // Non-square, so that a swapped width and height would show
+    Qx::Table<int> sec = table.section(1, 1, 2, 3);
+    QCOMPARE(sec.size(), QSize(3, 2));
+    QCOMPARE(sec.layout(), table.layout());
+    QCOMPARE(sec.firstRow(), (QList<int>{6, 7, 8}));
+    QCOMPARE(sec.lastRow(), (QList<int>{10, 11, 12}));
+
+    // Clamped to the table
+    sec = table.section(2, 2, 5, 5);
+    QCOMPARE(sec.size(), QSize(2, 1));
+    QCOMPARE(sec.firstRow(), (QList<int>{11, 12}));
+
+    // Out of bounds
+    QVERIFY(table.section(3, 0, 1, 1).isEmpty());
+    QVERIFY(table.section(0, 4, 1, 1).isEmpty());
+}
+
+QTEST_APPLESS_MAIN(tst_qx_table)
+#include "tst_qx_table.moc"
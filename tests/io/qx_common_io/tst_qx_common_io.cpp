@@ -1,8 +1,18 @@
+// Standard Library Includes
+#include <array>
+
 // Qt Includes
 #include <QtTest>
 
 // Qx Includes
+#include <qx/io/qx-asyncfile.h>
+#include <qx/io/qx-checksumengine.h>
 #include <qx/io/qx-common-io.h>
+#include <qx/io/qx-directorycopier.h>
+#include <qx/io/qx-dirwalker.h>
+#include <qx/io/qx-filestreamwriter.h>
+#include <qx/io/qx-textfileindex.h>
+#include <qx/io/qx-textsearcher.h>
 
 // Test Includes
 //#include <qx_test_common.h>
@@ -28,6 +38,20 @@ private slots:
     // Test cases
     void writeStringToFile_data();
     void writeStringToFile();
+    void checksumEngine();
+    void findStringInFile_data();
+    void findStringInFile();
+    void textSearcher_data();
+    void textSearcher();
+    void textFileIndex();
+    void inPlaceEdits();
+    void copyDirectory();
+    void dirContentEntryList();
+    void dirWalker();
+    void asyncFile();
+    void readBytesInPlace();
+    void bufferedStreamWriter();
+    void hashingStreamWriter();
 };
 
 // Setup
@@ -84,5 +108,607 @@ void tst_qx_common_io::writeStringToFile()
     file->close();
 }
 
+void tst_qx_common_io::checksumEngine()
+{
+    // Prepare files, including one that doesn't exist
+    QByteArray large(200 * 1024 + 3, Qt::Uninitialized);
+    for(qsizetype i = 0; i < large.size(); ++i)
+        large[i] = char(i % 253);
+
+    const QList<QByteArray> contents = {"", "checksum", large};
+    QStringList filePaths;
+    for(qsizetype i = 0; i < contents.size(); ++i)
+    {
+        QFile file(mWriteDir.filePath(u"hashed_%1.bin"_s.arg(i)));
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        QCOMPARE(file.write(contents.at(i)), contents.at(i).size());
+        filePaths.append(file.fileName());
+    }
+    filePaths.insert(1, mWriteDir.filePath(u"hashed_missing.bin"_s));
+
+    // Hash, with a buffer that doesn't evenly divide the files
+    Qx::ChecksumEngine engine(QCryptographicHash::Sha256, 2);
+    engine.setBufferSize(4093);
+    QFuture<Qx::ChecksumEngine::Result> future = engine.hashFiles(filePaths);
+    future.waitForFinished();
+    QCOMPARE(future.resultCount(), filePaths.size());
+    QCOMPARE(future.progressValue(), filePaths.size());
+
+    // Each result must be that of hashing its file on its own
+    for(qsizetype i = 0; i < filePaths.size(); ++i)
+    {
+        Qx::ChecksumEngine::Result result = future.resultAt(i);
+        QCOMPARE(result.filePath(), filePaths.at(i));
+
+        QString expected;
+        QFile file(filePaths.at(i));
+        Qx::IoOpReport rp = Qx::calculateFileChecksum(expected, file, QCryptographicHash::Sha256);
+        QCOMPARE(result.isFailure(), rp.isFailure());
+        if(rp.isFailure())
+            continue;
+
+        QCOMPARE(result.checksum(), expected);
+        QVERIFY(result.matches(expected.toUpper()));
+        QVERIFY(!result.matches(expected.chopped(1)));
+    }
+
+    // The missing file
+    Qx::ChecksumEngine::Result missing = future.resultAt(1);
+    QVERIFY(missing.isFailure());
+    QCOMPARE(missing.report().operation(), Qx::IO_OP_READ);
+    QCOMPARE(missing.report().result(), Qx::IO_ERR_DNE);
+    QVERIFY(missing.checksum().isEmpty());
+    QVERIFY(!missing.matches(QString()));
+}
+
+void tst_qx_common_io::findStringInFile_data()
+{
+    QTest::addColumn<QByteArray>("contents");
+    QTest::addColumn<QString>("query");
+    QTest::addColumn<Qt::CaseSensitivity>("cs");
+    QTest::addColumn<bool>("allowSplit");
+    QTest::addColumn<Qx::TextPos>("start");
+    QTest::addColumn<int>("hitsToSkip");
+    QTest::addColumn<int>("hitLimit");
+    QTest::addColumn<QList<Qx::TextPos>>("expected");
+
+    using P = Qx::TextPos;
+    using L = QList<Qx::TextPos>;
+
+    QTest::newRow("Basic") << QByteArray("one two\nthree two\n") << u"two"_s << Qt::CaseSensitive << false << P(0,0) << 0 << -1 << L{P(0,4), P(1,6)};
+    QTest::newRow("Overlapping prefix") << QByteArray("aaab") << u"aab"_s << Qt::CaseSensitive << false << P(0,0) << 0 << -1 << L{P(0,1)};
+    QTest::newRow("Non-overlapping") << QByteArray("aaaa") << u"aa"_s << Qt::CaseSensitive << false << P(0,0) << 0 << -1 << L{P(0,0), P(0,2)};
+    QTest::newRow("Case insensitive") << QByteArray("Two\r\ntWO") << u"two"_s << Qt::CaseInsensitive << false << P(0,0) << 0 << -1 << L{P(0,0), P(1,0)};
+    QTest::newRow("Split") << QByteArray("ab\r\ncd") << u"bc"_s << Qt::CaseSensitive << true << P(0,0) << 0 << -1 << L{P(0,1)};
+    QTest::newRow("No split") << QByteArray("ab\ncd") << u"bc"_s << Qt::CaseSensitive << false << P(0,0) << 0 << -1 << L{};
+    QTest::newRow("Start, skip and limit") << QByteArray("x x\nx x x x") << u"x"_s << Qt::CaseSensitive << false << P(1,1) << 1 << 2 << L{P(1,4), P(1,6)};
+    QTest::newRow("Start beyond line end") << QByteArray("ab\nab") << u"\na"_s << Qt::CaseSensitive << false << P(0,10) << 0 << -1 << L{P(0,2)};
+    QTest::newRow("Multi-byte") << QByteArray("\xEF\xBB\xBF\xC3\xA4\xF0\x9F\x98\x80z") << u"z"_s << Qt::CaseSensitive << false << P(0,0) << 0 << -1 << L{P(0,3)};
+    QTest::newRow("Last line") << QByteArray("ab\r\nab\nab") << u"ab"_s << Qt::CaseSensitive << false << P(Qx::Index32(Qx::Last),0) << 0 << -1 << L{P(2,0)};
+    QTest::newRow("Last character") << QByteArray("abc\nxcc") << u"c"_s << Qt::CaseSensitive << false << P(1,Qx::Index32(Qx::Last)) << 0 << -1 << L{P(1,2)};
+    QTest::newRow("Last line, trailing break") << QByteArray("ab\nab\n") << u"ab"_s << Qt::CaseSensitive << false << P(Qx::Index32(Qx::Last),0) << 0 << -1 << L{};
+}
+
+void tst_qx_common_io::findStringInFile()
+{
+    // Fetch data from test table
+    QFETCH(QByteArray, contents);
+    QFETCH(QString, query);
+    QFETCH(Qt::CaseSensitivity, cs);
+    QFETCH(bool, allowSplit);
+    QFETCH(Qx::TextPos, start);
+    QFETCH(int, hitsToSkip);
+    QFETCH(int, hitLimit);
+    QFETCH(QList<Qx::TextPos>, expected);
+
+    // Prepare file
+    QFile file(mWriteDir.filePath(u"find_string.txt"_s));
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QCOMPARE(file.write(contents), contents.size());
+    file.close();
+
+    // Search
+    Qx::TextQuery tq(query, cs);
+    tq.setAllowSplit(allowSplit);
+    tq.setStartPosition(start);
+    tq.setHitsToSkip(hitsToSkip);
+    tq.setHitLimit(hitLimit);
+
+    QList<Qx::TextPos> hits;
+    Qx::IoOpReport rp = Qx::findStringInFile(hits, file, tq);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    QCOMPARE(hits, expected);
+}
+
+void tst_qx_common_io::textSearcher_data()
+{
+    QTest::addColumn<Qt::CaseSensitivity>("cs");
+    QTest::addColumn<bool>("allowSplit");
+    QTest::addColumn<Qx::TextPos>("start");
+    QTest::addColumn<int>("hitsToSkip");
+    QTest::addColumn<int>("hitLimit");
+    QTest::addColumn<bool>("mixed");
+
+    using P = Qx::TextPos;
+
+    QTest::newRow("Default") << Qt::CaseSensitive << false << P(0,0) << 0 << -1 << false;
+    QTest::newRow("Case insensitive") << Qt::CaseInsensitive << false << P(0,0) << 0 << -1 << false;
+    QTest::newRow("Split") << Qt::CaseSensitive << true << P(0,0) << 0 << -1 << false;
+    QTest::newRow("Split, case insensitive") << Qt::CaseInsensitive << true << P(0,0) << 0 << -1 << false;
+    QTest::newRow("Skip") << Qt::CaseSensitive << false << P(0,0) << 2 << -1 << false;
+    QTest::newRow("Limit") << Qt::CaseSensitive << true << P(0,0) << 0 << 2 << false;
+    QTest::newRow("Skip and limit") << Qt::CaseInsensitive << false << P(0,0) << 1 << 1 << false;
+    QTest::newRow("Start") << Qt::CaseSensitive << false << P(1,2) << 0 << -1 << false;
+    QTest::newRow("Start beyond line end") << Qt::CaseSensitive << true << P(0,100) << 0 << -1 << false;
+    QTest::newRow("Last line") << Qt::CaseSensitive << false << P(Qx::Index32(Qx::Last),0) << 0 << -1 << false;
+    QTest::newRow("Last character") << Qt::CaseInsensitive << true << P(1,Qx::Index32(Qx::Last)) << 0 << -1 << false;
+    QTest::newRow("Start beyond file end") << Qt::CaseSensitive << false << P(50,0) << 0 << -1 << false;
+    QTest::newRow("Mixed") << Qt::CaseSensitive << false << P(0,0) << 0 << -1 << true;
+    QTest::newRow("Mixed, start, skip and limit") << Qt::CaseInsensitive << true << P(1,1) << 1 << 3 << true;
+}
+
+void tst_qx_common_io::textSearcher()
+{
+    // Fetch data from test table
+    QFETCH(Qt::CaseSensitivity, cs);
+    QFETCH(bool, allowSplit);
+    QFETCH(Qx::TextPos, start);
+    QFETCH(int, hitsToSkip);
+    QFETCH(int, hitLimit);
+    QFETCH(bool, mixed);
+
+    // Prepare files, including one that doesn't exist
+    const QList<QByteArray> contents = {
+        "abcab\nABC ab\nbab\n",
+        "ab\r\ncab\r\nABab\r\nbc",
+        "\xEF\xBB\xBF\xC3\xA4" "ab\n\xC3\x84" "AB\xC3\xA4\nabab",
+        "",
+        "\n\nab\n\nb\nc\n"
+    };
+    QStringList filePaths;
+    for(qsizetype i = 0; i < contents.size(); ++i)
+    {
+        QFile file(mWriteDir.filePath(u"searched_%1.txt"_s.arg(i)));
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        QCOMPARE(file.write(contents.at(i)), contents.at(i).size());
+        filePaths.append(file.fileName());
+    }
+    filePaths.append(mWriteDir.filePath(u"searched_missing.txt"_s));
+
+    // Queries that share prefixes and suffixes, overlap each other, and span line breaks
+    QList<Qx::TextQuery> queries;
+    const QStringList strings = {u"ab"_s, u"b"_s, u"abc"_s, u"bab"_s, u"bc"_s, u"\xE4"_s, u"b\nc"_s, u"abab"_s};
+    for(qsizetype i = 0; i < strings.size(); ++i)
+    {
+        // When mixed, every other query differs in its case sensitivity and splitting
+        bool flip = mixed && i % 2 == 1;
+        Qx::TextQuery query(strings.at(i), flip ? (cs == Qt::CaseSensitive ? Qt::CaseInsensitive : Qt::CaseSensitive) : cs);
+        query.setAllowSplit(flip ? !allowSplit : allowSplit);
+        query.setStartPosition(start);
+        query.setHitsToSkip(mixed ? hitsToSkip * (i % 3) : hitsToSkip);
+        query.setHitLimit(hitLimit);
+        queries.append(query);
+    }
+
+    // Search
+    Qx::TextSearcher searcher(queries, Qx::NoReadOptions, 3);
+    QFuture<Qx::TextSearcher::Result> future = searcher.search(filePaths);
+    future.waitForFinished();
+    QCOMPARE(future.resultCount(), filePaths.size());
+
+    // Compare against searching for each query on its own
+    for(qsizetype f = 0; f < filePaths.size(); ++f)
+    {
+        Qx::TextSearcher::Result result = future.resultAt(f);
+        QCOMPARE(result.filePath(), filePaths.at(f));
+
+        QFile file(filePaths.at(f));
+        bool anyHits = false;
+        for(qsizetype q = 0; q < queries.size(); ++q)
+        {
+            QList<Qx::TextPos> expected;
+            Qx::IoOpReport rp = Qx::findStringInFile(expected, file, queries.at(q));
+            QCOMPARE(result.isFailure(), rp.isFailure());
+            if(rp.isFailure())
+                continue;
+
+            QCOMPARE(result.hits(q), expected);
+            anyHits = anyHits || !expected.isEmpty();
+        }
+        QCOMPARE(result.hasHits(), anyHits);
+    }
+}
+
+void tst_qx_common_io::textFileIndex()
+{
+    // Prepare file
+    QFile file(mWriteDir.filePath(u"indexed.txt"_s));
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("zero\r\none\n\nthree\xC3\xA4\nfour\n");
+    file.close();
+
+    // Build
+    Qx::TextFileIndex index;
+    Qx::IoOpReport rp = Qx::TextFileIndex::build(index, file);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    QVERIFY(index.isCurrent(file));
+    QCOMPARE(index.lineCount(), 6);
+    QCOMPARE(index.lineCount(true), 5);
+    QCOMPARE(index.lineOffset(2), qint64(10));
+    QCOMPARE(index.lineOffset(6), qint64(-1));
+
+    // Indexed reads must match regular reads
+    const QList<std::pair<Qx::Index32, Qx::Index32>> ranges = {
+        {0, Qx::Index32(Qx::Last)}, {1, 3}, {3, 100}, {5, 5}, {Qx::Index32(Qx::Last), Qx::Index32(Qx::Last)}, {7, 9}
+    };
+    for(Qx::ReadOptions ro : {Qx::ReadOptions(Qx::NoReadOptions), Qx::ReadOptions(Qx::IgnoreTrailingBreak)})
+    {
+        for(const auto& [start, end] : ranges)
+        {
+            QStringList expected, actual;
+            QVERIFY(!Qx::readTextFromFile(expected, file, start, end, ro).isFailure());
+            QVERIFY(!Qx::readTextFromFile(actual, file, index, start, end, ro).isFailure());
+            QCOMPARE(actual, expected);
+        }
+    }
+
+    // Indexed inspection must match regular inspection
+    const QList<Qx::TextPos> positions = {
+        Qx::TextPos(Qx::Index32(Qx::Last), 0), Qx::TextPos(3, Qx::Index32(Qx::Last)), Qx::TextPos(Qx::Index32(Qx::Last), Qx::Index32(Qx::Last)),
+        Qx::TextPos(0, 100), Qx::TextPos(9, 0)
+    };
+    for(bool ignoreTrailingEmpty : {false, true})
+    {
+        int expectedCount, actualCount;
+        QVERIFY(!Qx::textFileLineCount(expectedCount, file, ignoreTrailingEmpty).isFailure());
+        QVERIFY(!Qx::textFileLineCount(actualCount, file, index, ignoreTrailingEmpty).isFailure());
+        QCOMPARE(actualCount, expectedCount);
+
+        for(const Qx::TextPos& pos : positions)
+        {
+            Qx::TextPos expected = pos, actual = pos;
+            QVERIFY(!Qx::textFileAbsolutePosition(expected, file, ignoreTrailingEmpty).isFailure());
+            QVERIFY(!Qx::textFileAbsolutePosition(actual, file, index, ignoreTrailingEmpty).isFailure());
+            QCOMPARE(actual, expected);
+        }
+    }
+
+    // Sidecar round trip
+    QFile sidecar(mWriteDir.filePath(u"indexed.txt.idx"_s));
+    QVERIFY(!index.save(sidecar).isFailure());
+
+    Qx::TextFileIndex loaded;
+    QVERIFY(!Qx::TextFileIndex::load(loaded, sidecar, file).isFailure());
+    QVERIFY(!loaded.isNull());
+    QCOMPARE(loaded.lineCount(), index.lineCount());
+    QCOMPARE(loaded.lineOffset(4), index.lineOffset(4));
+}
+
+void tst_qx_common_io::inPlaceEdits()
+{
+    // Prepare file
+    QFile file(mWriteDir.filePath(u"edited.txt"_s));
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("zero\none\ntw\xC3\xA4o\n");
+    file.close();
+
+    // Text
+    Qx::IoOpReport rp = Qx::writeStringToFile(file, u"ONE "_s, Qx::Insert, Qx::TextPos(1, 0));
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    rp = Qx::writeStringToFile(file, u"X"_s, Qx::Insert, Qx::TextPos(2, 3));
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    rp = Qx::deleteTextFromFile(file, Qx::TextPos(0, 2), Qx::TextPos(1, 3));
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+
+    // The text on either side of a deletion that spans lines stays on separate lines
+    QVERIFY(file.open(QIODevice::ReadOnly | QIODevice::Text));
+    QCOMPARE(file.readAll(), QByteArray("ze\none\ntw\xC3\xA4Xo\n"));
+    file.close();
+
+    // Breaks that remain aren't doubled
+    rp = Qx::deleteTextFromFile(file, Qx::TextPos(0, 1), Qx::TextPos(1, Qx::Index32(Qx::Last)));
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    rp = Qx::deleteTextFromFile(file, Qx::TextPos(1, 0), Qx::TextPos(1, 1));
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+
+    QVERIFY(file.open(QIODevice::ReadOnly | QIODevice::Text));
+    QCOMPARE(file.readAll(), QByteArray("z\n\xC3\xA4Xo\n"));
+    file.close();
+
+    QByteArray contents;
+
+    // Bytes, spanning several shift buffers
+    QByteArray original(3 * 1024 * 1024 + 5, Qt::Uninitialized);
+    for(qsizetype i = 0; i < original.size(); ++i)
+        original[i] = char(i % 251);
+    QVERIFY(!Qx::writeBytesToFile(file, original).isFailure());
+
+    rp = Qx::writeBytesToFile(file, "inserted", Qx::Insert, 1000);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+
+    QByteArray expected = original;
+    expected.insert(1000, "inserted");
+    QVERIFY(!Qx::readBytesFromFile(contents, file).isFailure());
+    QCOMPARE(contents, expected);
+}
+
+void tst_qx_common_io::copyDirectory()
+{
+    // Prepare tree
+    QDir source(mWriteDir.filePath(u"copy_source"_s));
+    QVERIFY(source.mkpath(u"a/b"_s));
+    QVERIFY(source.mkpath(u"empty"_s));
+    for(const QString& path : {u"root.txt"_s, u"a/one.txt"_s, u"a/b/two.txt"_s})
+    {
+        QFile file(source.filePath(path));
+        QVERIFY(!Qx::writeStringToFile(file, path).isFailure());
+    }
+
+    // Copy
+    QDir destination(mWriteDir.filePath(u"copy_destination"_s));
+    Qx::IoOpReport rp = Qx::copyDirectory(source, destination);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    QVERIFY(destination.exists(u"empty"_s));
+
+    QString contents;
+    QFile copied(destination.filePath(u"a/b/two.txt"_s));
+    QVERIFY(!Qx::readTextFromFile(contents, copied).isFailure());
+    QCOMPARE(contents, u"a/b/two.txt"_s);
+
+    // Conflicts
+    QCOMPARE(Qx::copyDirectory(source, destination, true, Qx::Stop).result(), Qx::IO_ERR_EXISTS);
+    rp = Qx::copyDirectory(source, destination, true, Qx::Skip);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+
+    // A conflict stops the copy before any file is queued
+    Qx::DirectoryCopier copier(Qx::Stop);
+    QFuture<Qx::IoOpReport> future = copier.copy(source, destination);
+    QCOMPARE(future.result().result(), Qx::IO_ERR_EXISTS);
+    QCOMPARE(future.progressValue(), 0);
+}
+
+void tst_qx_common_io::dirContentEntryList()
+{
+    // Prepare tree
+    QDir tree(mWriteDir.filePath(u"enumerated"_s));
+    QVERIFY(tree.mkpath(u"a/b"_s));
+    QVERIFY(tree.mkpath(u".hidden"_s));
+    for(const QString& path : {u"x.CPP"_s, u"y.h"_s, u"a/z.cpp"_s, u"a/b/w.txt"_s, u".hidden/in.cpp"_s, u".dot"_s})
+    {
+        QFile file(tree.filePath(path));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+    }
+
+    // Entries must match those of QDirIterator
+    const QList<std::tuple<QStringList, QDir::Filters, QDirIterator::IteratorFlags>> cases = {
+        {{}, QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories},
+        {{}, QDir::AllEntries, QDirIterator::NoIteratorFlags},
+        {{u"*.cpp"_s}, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot, QDirIterator::Subdirectories},
+        {{u"*.cpp"_s}, QDir::Files | QDir::AllDirs | QDir::CaseSensitive | QDir::NoDotAndDotDot, QDirIterator::Subdirectories},
+        {{u"?.h"_s, u"*.T?T"_s}, QDir::AllEntries | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories}
+    };
+    for(const auto& [nameFilters, filters, flags] : cases)
+    {
+        QStringList expected;
+        QDirIterator itr(tree.path(), nameFilters, filters, flags);
+        while(itr.hasNext())
+            expected.append(itr.next());
+
+        QList<Qx::DirEntry> entries;
+        Qx::IoOpReport rp = Qx::dirContentEntryList(entries, tree, nameFilters, filters, flags);
+        QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+
+        QStringList actual;
+        for(const Qx::DirEntry& entry : std::as_const(entries))
+        {
+            actual.append(entry.path());
+            QCOMPARE(entry.isDir(), QFileInfo(entry.path()).isDir());
+        }
+
+        expected.sort();
+        actual.sort();
+        QCOMPARE(actual, expected);
+    }
+
+    // Containment
+    QVERIFY(tree.mkpath(u"only_dirs/sub"_s));
+    QDir onlyDirs(tree.filePath(u"only_dirs"_s));
+    QVERIFY(!Qx::dirContainsFiles(onlyDirs, QDirIterator::Subdirectories));
+    QVERIFY(Qx::dirContainsFiles(QDir(tree.filePath(u"a"_s)), QDirIterator::NoIteratorFlags));
+}
+
+void tst_qx_common_io::dirWalker()
+{
+    // Prepare tree
+    QDir tree(mWriteDir.filePath(u"walked"_s));
+    for(const QString& path : {u"a/b/c"_s, u"a/d"_s, u"e"_s, u".hidden/f"_s})
+    {
+        QVERIFY(tree.mkpath(path));
+        QFile file(tree.filePath(path + u"/file.txt"_s));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+    }
+
+    // Entries must match those of QDirIterator
+    QStringList expected;
+    QDirIterator itr(tree.path(), QDir::AllEntries | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+    while(itr.hasNext())
+        expected.append(itr.next());
+
+    QMutex mutex;
+    QStringList actual;
+    auto collect = [&](const Qx::DirEntry& entry){
+        QMutexLocker locker(&mutex);
+        actual.append(entry.path());
+    };
+
+    Qx::DirWalker walker(4);
+    walker.setFilters(QDir::AllEntries | QDir::NoDotAndDotDot);
+    Qx::IoOpReport rp = walker.walk(tree, collect).result();
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+
+    expected.sort();
+    actual.sort();
+    QCOMPARE(actual, expected);
+
+    // Depth limit
+    actual.clear();
+    walker.setMaxDepth(1);
+    walker.setFilters(QDir::Files);
+    walker.walk(tree, collect).waitForFinished();
+    QCOMPARE(actual, QStringList{tree.filePath(u"e/file.txt"_s)});
+
+    // Missing directory
+    QCOMPARE(walker.walk(QDir(tree.filePath(u"missing"_s)), collect).result().result(), Qx::IO_ERR_DNE);
+
+    // Cancellation must reach workers that are waiting for directories
+    QSemaphore visiting, resume;
+    walker.setMaxDepth(-1);
+    walker.setFilters(QDir::AllEntries | QDir::NoDotAndDotDot);
+    QFuture<Qx::IoOpReport> canceled = walker.walk(tree, [&](const Qx::DirEntry&){
+        visiting.release();
+        resume.acquire();
+    });
+    visiting.acquire();
+    canceled.cancel();
+    resume.release(expected.size());
+    walker.waitForDone();
+    QVERIFY(canceled.isCanceled());
+}
+
+void tst_qx_common_io::asyncFile()
+{
+    QByteArray data;
+    for(int i = 0; i < 1000; ++i)
+        data.append(QByteArray::number(i).rightJustified(8, '0'));
+
+    // Write in pieces
+    Qx::AsyncFile file(mWriteDir.filePath(u"async.bin"_s));
+    Qx::IoOpReport rp = file.open(QIODevice::ReadWrite);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+
+    QList<QFuture<Qx::IoOpReport>> writes;
+    {
+        Qx::AsyncFile::Batch batch(file);
+        for(qsizetype pos = 0; pos < data.size(); pos += 1000)
+            writes.append(file.write(std::as_bytes(std::span(data).subspan(pos, 1000)), pos));
+    }
+    file.waitForDone();
+    for(const QFuture<Qx::IoOpReport>& write : std::as_const(writes))
+        QVERIFY2(!write.result().isFailure(), qPrintable(write.result().outcomeInfo()));
+
+    // Read back
+    QByteArray readBack(data.size(), '\0');
+    rp = file.read(std::as_writable_bytes(std::span(readBack)), 0).result();
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    QCOMPARE(readBack, data);
+
+    QByteArray past(16, '\0');
+    QCOMPARE(file.read(std::as_writable_bytes(std::span(past)), data.size() - 8).result().result(), Qx::IO_ERR_FILE_SIZE_MISMATCH);
+    QCOMPARE(past.left(8), data.right(8));
+
+    file.close();
+    QCOMPARE(file.read(std::as_writable_bytes(std::span(past)), 0).result().result(), Qx::IO_ERR_FILE_NOT_OPEN);
+}
+
+void tst_qx_common_io::readBytesInPlace()
+{
+    QFile file(mWriteDir.filePath(u"bytes.bin"_s));
+    const QByteArray data = "0123456789abcdef"_ba;
+    QVERIFY(!Qx::writeBytesToFile(file, data).isFailure());
+
+    // Caller buffer, reading through the end
+    std::array<std::byte, 8> buffer;
+    qint64 bytesRead;
+    Qx::IoOpReport rp = Qx::readBytesFromFile(buffer, bytesRead, file, 12);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    QCOMPARE(bytesRead, qint64(4));
+    QCOMPARE(QByteArray(reinterpret_cast<const char*>(buffer.data()), bytesRead), "cdef"_ba);
+    QVERIFY(!file.isOpen());
+
+    // Open files are left as is
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QVERIFY(file.seek(3));
+    QVERIFY(!Qx::readBytesFromFile(buffer, bytesRead, file, 0).isFailure());
+    QCOMPARE(bytesRead, qint64(8));
+    QVERIFY(file.isOpen());
+    QCOMPARE(file.pos(), qint64(3));
+    file.close();
+
+    // Mapping
+    Qx::FileMapping mapping;
+    rp = Qx::mapBytesFromFile(mapping, file, 4, 9);
+    QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+    QCOMPARE(mapping.view().toByteArray(), "456789"_ba);
+
+    Qx::FileMapping moved = std::move(mapping);
+    QVERIFY(mapping.isNull());
+    QCOMPARE(moved.view().toByteArray(), "456789"_ba);
+
+    QVERIFY(!Qx::mapBytesFromFile(mapping, file, 20).isFailure());
+    QVERIFY(mapping.isNull());
+}
+
+void tst_qx_common_io::bufferedStreamWriter()
+{
+    QByteArray expected;
+    QDataStream expectedStream(&expected, QIODevice::WriteOnly);
+    for(quint32 i = 0; i < 10000; ++i)
+        expectedStream << i << qint8(i);
+    expectedStream.writeRawData("end", 3);
+
+    for(bool background : {false, true})
+    {
+        const QString path = mWriteDir.filePath(u"buffered.bin"_s);
+        Qx::FileStreamWriter writer(path, Qx::Truncate);
+        writer.setBufferSize(100); // Not a multiple of the record size
+        writer.setBackgroundFlush(background);
+        QVERIFY(!writer.openFile().isFailure());
+
+        for(quint32 i = 0; i < 10000; ++i)
+            writer << i << qint8(i);
+        QVERIFY(!writer.writeRawData("end"_ba).isFailure());
+
+        Qx::IoOpReport rp = writer.flush();
+        QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+        writer.closeFile();
+
+        QFile file(path);
+        QByteArray written;
+        QVERIFY(!Qx::readBytesFromFile(written, file).isFailure());
+        QCOMPARE(written, expected);
+    }
+}
+
+void tst_qx_common_io::hashingStreamWriter()
+{
+    QByteArray expected;
+    QDataStream expectedStream(&expected, QIODevice::WriteOnly);
+    for(quint32 i = 0; i < 1000; ++i)
+        expectedStream << i << qint8(i);
+    expectedStream.writeRawData("end", 3);
+
+    // Unbuffered, buffered, and buffered in the background
+    for(auto [bufferSize, background] : {std::pair{0, false}, std::pair{100, false}, std::pair{100, true}})
+    {
+        const QString path = mWriteDir.filePath(u"hashed.bin"_s);
+        Qx::Hasher hasher(QCryptographicHash::Sha256);
+        Qx::FileStreamWriter writer(path, Qx::Truncate);
+        writer.setBufferSize(bufferSize);
+        writer.setBackgroundFlush(background);
+        writer.setHasher(&hasher);
+        QVERIFY(!writer.openFile().isFailure());
+
+        for(quint32 i = 0; i < 1000; ++i)
+            writer << i << qint8(i);
+        QVERIFY(!writer.writeRawData("end"_ba).isFailure());
+
+        Qx::IoOpReport rp = writer.flush();
+        QVERIFY2(!rp.isFailure(), qPrintable(rp.outcomeInfo()));
+        writer.closeFile();
+
+        QCOMPARE(hasher.result(), QCryptographicHash::hash(expected, QCryptographicHash::Sha256));
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_qx_common_io)
 #include "tst_qx_common_io.moc"